@@ -31,3 +31,11 @@ if(WIN32)
     set(CMAKE_RUNTIME_OUTPUT_DIRECTORY_RELEASE ${CMAKE_BINARY_DIR})
     set(CMAKE_ARCHIVE_OUTPUT_DIRECTORY_RELEASE ${CMAKE_BINARY_DIR})
 endif()
+
+# Sampling kernels are written as branch-free loops over blocks; with host-specific
+# instructions (AVX2 gathers etc.) the compiler vectorizes them
+option(PTM_NATIVE_ARCH "Optimize for the host CPU instruction set" OFF)
+
+if(PTM_NATIVE_ARCH AND NOT CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
+    add_compile_options(-march=native)
+endif()
@@ -0,0 +1,147 @@
+#include <stdexcept>
+
+#include "AliasTable.hpp"
+#include "RandomBits.hpp"
+
+namespace ptm {
+
+AliasTable::AliasTable(const std::vector<double>& weights, std::int64_t first) :
+    threshold_(weights.size()), alias_(weights.size()), first_(first) {
+  if (weights.empty() || weights.size() > kAliasTableMaxSize)
+    throw std::invalid_argument("Invalid alias table size");
+
+  double total = 0;
+
+  for (double weight : weights) {
+    if (weight < 0)
+      throw std::invalid_argument("Negative weight");
+
+    total += weight;
+  }
+
+  if (total <= 0)
+    throw std::invalid_argument("Zero total weight");
+
+  const auto size = static_cast<double>(weights.size());
+  std::vector<std::uint32_t> small;
+  std::vector<std::uint32_t> large;
+
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    threshold_[i] = weights[i] * size / total;
+    alias_[i] = static_cast<std::uint32_t>(i);
+
+    if (threshold_[i] < 1)
+      small.push_back(static_cast<std::uint32_t>(i));
+    else
+      large.push_back(static_cast<std::uint32_t>(i));
+  }
+
+  while (!small.empty() && !large.empty()) {
+    std::uint32_t less = small.back();
+    std::uint32_t more = large.back();
+    small.pop_back();
+
+    alias_[less] = more;
+    threshold_[more] -= 1 - threshold_[less];
+
+    if (threshold_[more] < 1) {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+
+  // Остатки из-за округления - ячейки с вероятностью 1
+  for (std::uint32_t i : small) {
+    threshold_[i] = 1;
+  }
+
+  for (std::uint32_t i : large) {
+    threshold_[i] = 1;
+  }
+}
+
+AliasTable AliasTable::FromPmf(const std::function<double(std::int64_t)>& pmf,
+                               std::int64_t mode,
+                               std::int64_t min,
+                               std::int64_t max,
+                               double tail_mass) {
+  std::int64_t low = mode;
+  std::int64_t high = mode;
+  double low_pmf = mode > min ? pmf(mode - 1) : 0;
+  double high_pmf = mode < max ? pmf(mode + 1) : 0;
+  double mass = pmf(mode);
+
+  std::vector<double> lower_weights;
+  std::vector<double> upper_weights = {mass};
+
+  while (mass < 1 - tail_mass && (low_pmf > 0 || high_pmf > 0) &&
+         lower_weights.size() + upper_weights.size() < kAliasTableMaxSize) {
+    if (high_pmf >= low_pmf) {
+      ++high;
+      upper_weights.push_back(high_pmf);
+      mass += high_pmf;
+      high_pmf = high < max ? pmf(high + 1) : 0;
+    } else {
+      --low;
+      lower_weights.push_back(low_pmf);
+      mass += low_pmf;
+      low_pmf = low > min ? pmf(low - 1) : 0;
+    }
+  }
+
+  std::vector<double> weights(lower_weights.rbegin(), lower_weights.rend());
+  weights.insert(weights.end(), upper_weights.begin(), upper_weights.end());
+
+  return {weights, low};
+}
+
+template <RandomEngine Engine>
+double AliasTable::Sample(Engine& rng) const {
+  return Lookup(NextBits64(rng));
+}
+
+template <RandomEngine Engine>
+void AliasTable::Fill(Engine& rng, std::span<double> out) const {
+  for (double& value : out) {
+    value = Lookup(NextBits64(rng));
+  }
+}
+
+std::size_t AliasTable::Size() const noexcept {
+  return threshold_.size();
+}
+
+std::int64_t AliasTable::First() const noexcept {
+  return first_;
+}
+
+double AliasTable::Lookup(std::uint64_t bits) const {
+  // Целая часть u * size - ячейка, дробная - монетка для выбора между ячейкой и её alias
+  const double scaled = BitsToUnit(bits) * static_cast<double>(threshold_.size());
+  const auto cell = static_cast<std::size_t>(scaled);
+  const double coin = scaled - static_cast<double>(cell);
+  const std::uint32_t index = coin < threshold_[cell] ? static_cast<std::uint32_t>(cell) : alias_[cell];
+
+  return static_cast<double>(first_ + index);
+}
+
+LazyAliasTable::LazyAliasTable(double tail_mass) : tail_mass_(tail_mass) {
+}
+
+const AliasTable& LazyAliasTable::Get(const std::function<AliasTable(double tail_mass)>& build) const {
+  std::call_once(built_, [&] { table_.emplace(build(tail_mass_)); });
+
+  return *table_;
+}
+
+double LazyAliasTable::TailMass() const noexcept {
+  return tail_mass_;
+}
+
+template double AliasTable::Sample(std::mt19937& rng) const;
+template double AliasTable::Sample(Philox4x32& rng) const;
+
+template void AliasTable::Fill(std::mt19937& rng, std::span<double> out) const;
+template void AliasTable::Fill(Philox4x32& rng, std::span<double> out) const;
+
+} // namespace ptm
@@ -0,0 +1,72 @@
+#ifndef PTM_ALIASTABLE_HPP_
+#define PTM_ALIASTABLE_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "random/RandomEngine.hpp"
+
+namespace ptm {
+
+// Масса хвостов, которую по умолчанию отбрасывает таблица
+const double kAliasTableTailMass = 1e-12;
+
+// Предельный размер носителя таблицы
+const std::size_t kAliasTableMaxSize = std::size_t{1} << 24;
+
+// Alias-таблица Уолкера (построение Vose) для дискретного распределения на отрезке целых чисел.
+// Каждый сэмпл - одно 64-битное слово генератора и одно обращение к таблице
+class AliasTable {
+public:
+  // weights[i] - вероятность (не обязательно нормированная) значения first + i
+  AliasTable(const std::vector<double>& weights, std::int64_t first);
+
+  // Таблица по pmf целочисленного распределения на [min, max]. Носитель растёт от моды в сторону
+  // большей вероятности, пока не наберётся масса 1 - tail_mass; отброшенные хвосты распределяются
+  // пропорционально по оставшимся значениям
+  static AliasTable FromPmf(const std::function<double(std::int64_t)>& pmf,
+                            std::int64_t mode,
+                            std::int64_t min,
+                            std::int64_t max,
+                            double tail_mass);
+
+  template <RandomEngine Engine>
+  double Sample(Engine& rng) const;
+
+  template <RandomEngine Engine>
+  void Fill(Engine& rng, std::span<double> out) const;
+
+  [[nodiscard]] std::size_t Size() const noexcept;
+  [[nodiscard]] std::int64_t First() const noexcept;
+
+private:
+  std::vector<double> threshold_;
+  std::vector<std::uint32_t> alias_;
+  std::int64_t first_;
+
+  [[nodiscard]] double Lookup(std::uint64_t bits) const;
+};
+
+// Таблица, которая строится при первом обращении. Потокобезопасна; распределения держат её
+// через std::shared_ptr, так что копии распределения делят одну таблицу
+class LazyAliasTable {
+public:
+  explicit LazyAliasTable(double tail_mass);
+
+  const AliasTable& Get(const std::function<AliasTable(double tail_mass)>& build) const;
+
+  [[nodiscard]] double TailMass() const noexcept;
+
+private:
+  double tail_mass_;
+  mutable std::once_flag built_;
+  mutable std::optional<AliasTable> table_;
+};
+
+} // namespace ptm
+
+#endif // PTM_ALIASTABLE_HPP_
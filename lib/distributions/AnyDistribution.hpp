@@ -0,0 +1,67 @@
+#ifndef PTM_ANYDISTRIBUTION_HPP_
+#define PTM_ANYDISTRIBUTION_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <variant>
+
+#include "BernoulliDistribution.hpp"
+#include "BinomialDistribution.hpp"
+#include "CauchyDistribution.hpp"
+#include "ExponentialDistribution.hpp"
+#include "GeometricDistribution.hpp"
+#include "LaplaceDistribution.hpp"
+#include "NormalDistribution.hpp"
+#include "PoissonDistribution.hpp"
+#include "UniformDistribution.hpp"
+
+namespace ptm {
+
+// Закрытый набор поставляемых распределений. Вызовы через конкретный (final) тип не виртуальные,
+// поэтому компилятор может их встраивать
+using AnyDistribution = std::variant<BernoulliDistribution,
+                                     BinomialDistribution,
+                                     CauchyDistribution,
+                                     ExponentialDistribution,
+                                     GeometricDistribution,
+                                     LaplaceDistribution,
+                                     NormalDistribution,
+                                     PoissonDistribution,
+                                     UniformDistribution>;
+
+// Копия распределения, если его тип входит в AnyDistribution
+template <std::size_t Index = 0>
+std::optional<AnyDistribution> ToAnyDistribution(const Distribution& dist) {
+  if constexpr (Index == std::variant_size_v<AnyDistribution>) {
+    return std::nullopt;
+  } else {
+    using Concrete = std::variant_alternative_t<Index, AnyDistribution>;
+
+    if (const auto* concrete = dynamic_cast<const Concrete*>(&dist))
+      return AnyDistribution(std::in_place_index<Index>, *concrete);
+
+    return ToAnyDistribution<Index + 1>(dist);
+  }
+}
+
+// Вызывает visitor(std::shared_ptr<const D>), где D - конкретный тип распределения из AnyDistribution.
+// Для прочих наследников Distribution D = Distribution. Тип определяется один раз на вызов
+template <std::size_t Index = 0, class Visitor>
+decltype(auto) VisitDistribution(const std::shared_ptr<const Distribution>& dist, Visitor&& visitor) {
+  if constexpr (Index == std::variant_size_v<AnyDistribution>) {
+    return std::forward<Visitor>(visitor)(dist);
+  } else {
+    using Concrete = std::variant_alternative_t<Index, AnyDistribution>;
+
+    if (auto concrete = std::dynamic_pointer_cast<const Concrete>(dist))
+      return std::forward<Visitor>(visitor)(std::move(concrete));
+
+    return VisitDistribution<Index + 1>(dist, std::forward<Visitor>(visitor));
+  }
+}
+
+} // namespace ptm
+
+#endif // PTM_ANYDISTRIBUTION_HPP_
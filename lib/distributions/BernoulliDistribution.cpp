@@ -1,4 +1,5 @@
 #include "BernoulliDistribution.hpp"
+#include "RandomBits.hpp"
 
 namespace ptm {
 
@@ -21,10 +22,26 @@ double BernoulliDistribution::Cdf(double x) const {
     return 1;
 }
 
+double BernoulliDistribution::Quantile(double p) const {
+  CheckProbability(p);
+
+  return p <= 1 - p_ ? 0 : 1;
+}
+
 double BernoulliDistribution::Sample(std::mt19937& rng) const {
-  std::bernoulli_distribution distribution(p_);
+  return SampleImpl(rng);
+}
+
+double BernoulliDistribution::Sample(Philox4x32& rng) const {
+  return SampleImpl(rng);
+}
+
+void BernoulliDistribution::SampleBatch(std::mt19937& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
+}
 
-  return distribution(rng);
+void BernoulliDistribution::SampleBatch(Philox4x32& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
 }
 
 double BernoulliDistribution::TheoreticalMean() const {
@@ -35,4 +52,21 @@ double BernoulliDistribution::TheoreticalVariance() const {
   return p_ * (1 - p_);
 }
 
+double BernoulliDistribution::GetP() const {
+  return p_;
+}
+
+template <RandomEngine Engine>
+double BernoulliDistribution::SampleImpl(Engine& rng) const {
+  // Одно слово генератора и одно сравнение - таблица здесь не нужна
+  return BitsToUnit(NextBits64(rng)) < p_ ? 1 : 0;
+}
+
+template <RandomEngine Engine>
+void BernoulliDistribution::SampleBatchImpl(Engine& rng, std::span<double> out) const {
+  for (double& value : out) {
+    value = BitsToUnit(NextBits64(rng)) < p_ ? 1 : 0;
+  }
+}
+
 } // namespace ptm
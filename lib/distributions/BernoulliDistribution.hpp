@@ -8,19 +8,31 @@
 namespace ptm {
 
 // Бернулли Bernoulli(p)
-class BernoulliDistribution : public Distribution {
+class BernoulliDistribution final : public Distribution {
 public:
   explicit BernoulliDistribution(double p);
 
   [[nodiscard]] double Pdf(double x) const override;
   [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double p) const override;
   double Sample(std::mt19937& rng) const override;
+  double Sample(Philox4x32& rng) const override;
+  void SampleBatch(std::mt19937& rng, std::span<double> out) const override;
+  void SampleBatch(Philox4x32& rng, std::span<double> out) const override;
 
   [[nodiscard]] double TheoreticalMean() const override;
   [[nodiscard]] double TheoreticalVariance() const override;
 
+  [[nodiscard]] double GetP() const;
+
 private:
   double p_;
+
+  template <RandomEngine Engine>
+  double SampleImpl(Engine& rng) const;
+
+  template <RandomEngine Engine>
+  void SampleBatchImpl(Engine& rng, std::span<double> out) const;
 };
 
 } // namespace ptm
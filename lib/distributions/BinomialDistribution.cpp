@@ -1,27 +1,51 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <numbers>
+#include <stdexcept>
 
 #include "BinomialDistribution.hpp"
+#include "SpecialFunctions.hpp"
 
 namespace ptm {
 
 BinomialDistribution::BinomialDistribution(unsigned int n, double p) : n_(n), p_(p) {
 }
 
-double BinomialDistribution::Pdf(double x) const {
-  const std::uint32_t moivre_laplace_formula_n_border = 100;
-  const double moivre_laplace_formula_p_border = 0.1;
+void BinomialDistribution::EnableAliasTable(double tail_mass) {
+  if (tail_mass < 0 || tail_mass >= 1)
+    throw std::invalid_argument("Tail mass must be in [0, 1)");
+
+  alias_table_ = std::make_shared<LazyAliasTable>(tail_mass);
+}
+
+void BinomialDistribution::EnableTable() {
+  if (n_ > kBinomialMaxTableSize)
+    throw std::invalid_argument("Binomial table is too large");
+
+  auto table = std::make_shared<Table>();
+  table->pmf.resize(n_ + 1);
+  table->cdf.resize(n_ + 1);
+
+  double cumulative = 0;
 
+  for (std::uint32_t k = 0; k <= n_; ++k) {
+    table->pmf[k] = std::exp(LogPmf(k));
+    cumulative += table->pmf[k];
+    table->cdf[k] = std::min(cumulative, 1.0);
+  }
+
+  table_ = std::move(table);
+}
+
+double BinomialDistribution::Pdf(double x) const {
   if (std::round(x) != x || x < 0 || x > n_)
     return 0;
 
-  auto k = static_cast<std::uint32_t>(x);
+  if (table_)
+    return table_->pmf[static_cast<std::size_t>(x)];
 
-  if (n_ < moivre_laplace_formula_n_border)
-    return BernoulliFormula(k);
-  else if (p_ < moivre_laplace_formula_p_border)
-    return PoissonFormula(k);
-  else
-    return MoivreLaplaceFormula(k);
+  return std::exp(LogPmf(x));
 }
 
 double BinomialDistribution::Cdf(double x) const {
@@ -31,15 +55,60 @@ double BinomialDistribution::Cdf(double x) const {
   if (x >= n_)
     return 1;
 
-  double border = (x - n_ * p_) / std::sqrt(n_ * p_ * (1 - p_));
+  const double k = std::floor(x);
+
+  if (table_)
+    return table_->cdf[static_cast<std::size_t>(k)];
+
+  // P(X <= k) = I_{1-p}(n - k, k + 1)
+  return RegularizedIncompleteBeta(n_ - k, k + 1, 1 - p_);
+}
+
+double BinomialDistribution::Quantile(double p) const {
+  CheckProbability(p);
+
+  if (table_) {
+    auto it = std::lower_bound(table_->cdf.begin(), table_->cdf.end(), p);
+
+    return static_cast<double>(std::min<std::ptrdiff_t>(it - table_->cdf.begin(), n_));
+  }
+
+  if (p == 0)
+    return 0;
+
+  if (p == 1)
+    return n_;
+
+  // Старт - нормальное приближение, дальше шаги по точной Cdf: обычно их единицы
+  const double mean = TheoreticalMean();
+  const double sigma = std::sqrt(TheoreticalVariance());
+  double k = std::clamp(std::floor(mean + sigma * StandardNormalQuantile(p)), 0.0, static_cast<double>(n_));
+
+  while (k > 0 && Cdf(k - 1) >= p) {
+    --k;
+  }
+
+  while (k < n_ && Cdf(k) < p) {
+    ++k;
+  }
 
-  return std::erf(border / std::numbers::sqrt2) / 2;
+  return k;
 }
 
 double BinomialDistribution::Sample(std::mt19937& rng) const {
-  std::binomial_distribution<std::uint32_t> distribution(n_, p_);
+  return SampleImpl(rng);
+}
 
-  return distribution(rng);
+double BinomialDistribution::Sample(Philox4x32& rng) const {
+  return SampleImpl(rng);
+}
+
+void BinomialDistribution::SampleBatch(std::mt19937& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
+}
+
+void BinomialDistribution::SampleBatch(Philox4x32& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
 }
 
 double BinomialDistribution::TheoreticalMean() const {
@@ -50,35 +119,63 @@ double BinomialDistribution::TheoreticalVariance() const {
   return n_ * p_ * (1 - p_);
 }
 
-double BinomialDistribution::BernoulliFormula(std::uint32_t k) const {
-  double result = 1;
+unsigned int BinomialDistribution::GetN() const {
+  return n_;
+}
 
-  for (std::uint32_t i = 1; i <= k; ++i) {
-    result *= n_ + 1 - i;
-    result /= i;
-  }
+double BinomialDistribution::GetP() const {
+  return p_;
+}
 
-  result *= std::pow(p_, k);
-  result *= std::pow(1 - p_, n_ - k);
+double BinomialDistribution::LogPmf(double k) const {
+  const double failures = n_ - k;
 
-  return result;
+  if (p_ == 0 || p_ == 1)
+    return k == (p_ == 0 ? 0 : n_) ? 0 : -std::numeric_limits<double>::infinity();
+
+  if (k == 0)
+    return n_ * std::log1p(-p_);
+
+  if (failures == 0)
+    return n_ * std::log(p_);
+
+  // Седловая форма Loader: без разности lgamma больших чисел
+  return StirlingError(n_) - StirlingError(k) - StirlingError(failures) - Deviance(k, n_ * p_) -
+         Deviance(failures, n_ * (1 - p_)) + std::log(n_ / (2 * std::numbers::pi * k * failures)) / 2;
 }
 
-double BinomialDistribution::PoissonFormula(std::uint32_t k) const {
-  double lambda = n_ * (1 - n_);
-  double k_fact = 1;
+const AliasTable& BinomialDistribution::GetAliasTable() const {
+  return alias_table_->Get([this](double tail_mass) {
+    return AliasTable::FromPmf([this](std::int64_t k) { return Pdf(static_cast<double>(k)); },
+                               std::min<std::int64_t>(static_cast<std::int64_t>((n_ + 1.0) * p_), n_),
+                               0,
+                               n_,
+                               tail_mass);
+  });
+}
 
-  for (uint32_t i = k; i > 1; --i) {
-    k_fact *= i;
-  }
+template <RandomEngine Engine>
+double BinomialDistribution::SampleImpl(Engine& rng) const {
+  if (alias_table_)
+    return GetAliasTable().Sample(rng);
+
+  std::binomial_distribution<std::uint32_t> distribution(n_, p_);
 
-  return std::pow(lambda, k) * std::exp(-lambda) / k_fact;
+  return distribution(rng);
 }
 
-double BinomialDistribution::MoivreLaplaceFormula(std::uint32_t k) const {
-  double x = (k - p_ * n_) / std::sqrt(n_ * p_ * (1 - p_));
+template <RandomEngine Engine>
+void BinomialDistribution::SampleBatchImpl(Engine& rng, std::span<double> out) const {
+  if (alias_table_) {
+    GetAliasTable().Fill(rng, out);
+    return;
+  }
+
+  std::binomial_distribution<std::uint32_t> distribution(n_, p_);
 
-  return std::exp(-x * x / 2) / std::sqrt(2 * std::numbers::pi * n_ * p_ * (1 - p_));
+  for (double& value : out) {
+    value = distribution(rng);
+  }
 }
 
 } // namespace ptm
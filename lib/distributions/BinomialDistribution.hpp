@@ -1,31 +1,66 @@
 #ifndef PTM_BINOMIALDISTRIBUTION_HPP_
 #define PTM_BINOMIALDISTRIBUTION_HPP_
 
+#include <memory>
 #include <random>
+#include <vector>
 
+#include "AliasTable.hpp"
 #include "Distribution.hpp"
 
 namespace ptm {
 
+// Наибольшее n, для которого строятся полные таблицы PMF/CDF
+const std::uint32_t kBinomialMaxTableSize = 1u << 20;
+
 // Биномиальное Binomial(n, p)
-class BinomialDistribution : public Distribution {
+class BinomialDistribution final : public Distribution {
 public:
   BinomialDistribution(unsigned int n, double p);
 
   [[nodiscard]] double Pdf(double x) const override;
   [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double p) const override;
   double Sample(std::mt19937& rng) const override;
+  double Sample(Philox4x32& rng) const override;
+  void SampleBatch(std::mt19937& rng, std::span<double> out) const override;
+  void SampleBatch(Philox4x32& rng, std::span<double> out) const override;
 
   [[nodiscard]] double TheoreticalMean() const override;
   [[nodiscard]] double TheoreticalVariance() const override;
 
+  [[nodiscard]] unsigned int GetN() const;
+  [[nodiscard]] double GetP() const;
+
+  // Включает выборку через alias-таблицу, которая строится при первой генерации.
+  // Хвосты массой tail_mass отбрасываются
+  void EnableAliasTable(double tail_mass = kAliasTableTailMass);
+
+  // Заранее считает PMF и CDF во всех точках 0..n, после чего Pdf и Cdf - обращения к таблице.
+  // Допустимо при n <= kBinomialMaxTableSize
+  void EnableTable();
+
 private:
+  // Вероятности и функция распределения в точках 0..n
+  struct Table {
+    std::vector<double> pmf;
+    std::vector<double> cdf;
+  };
+
   std::uint32_t n_;
   double p_;
+  std::shared_ptr<LazyAliasTable> alias_table_;
+  std::shared_ptr<const Table> table_;
+
+  // Логарифм вероятности целого k из 0..n
+  [[nodiscard]] double LogPmf(double k) const;
+  [[nodiscard]] const AliasTable& GetAliasTable() const;
+
+  template <RandomEngine Engine>
+  double SampleImpl(Engine& rng) const;
 
-  double BernoulliFormula(std::uint32_t k) const;
-  double PoissonFormula(std::uint32_t k) const;
-  double MoivreLaplaceFormula(std::uint32_t k) const;
+  template <RandomEngine Engine>
+  void SampleBatchImpl(Engine& rng, std::span<double> out) const;
 };
 
 } // namespace ptm
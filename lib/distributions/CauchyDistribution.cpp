@@ -1,6 +1,12 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <numbers>
 
 #include "CauchyDistribution.hpp"
+#include "VectorMath.hpp"
+#include "Ziggurat.hpp"
 
 namespace ptm {
 
@@ -15,10 +21,51 @@ double CauchyDistribution::Cdf(double x) const {
   return kCauchyDistributionX0 + std::atan((x - x0_) / gamma_) / std::numbers::pi;
 }
 
+double CauchyDistribution::Quantile(double p) const {
+  CheckProbability(p);
+
+  if (p == 0 || p == 1)
+    return p == 0 ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+
+  return x0_ + gamma_ * std::tan(std::numbers::pi * (p - kCauchyDistributionX0));
+}
+
+std::optional<double> CauchyDistribution::SymmetryCenter() const {
+  return x0_;
+}
+
+void CauchyDistribution::PdfBatch(std::span<const double> x, std::span<double> out) const {
+  const double scale = 1 / gamma_;
+  const double factor = scale / std::numbers::pi;
+
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    const double z = (x[i] - x0_) * scale;
+    out[i] = factor / (1 + z * z);
+  }
+}
+
+void CauchyDistribution::CdfBatch(std::span<const double> x, std::span<double> out) const {
+  const double scale = 1 / gamma_;
+
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    out[i] = kCauchyDistributionX0 + FastAtan((x[i] - x0_) * scale) / std::numbers::pi;
+  }
+}
+
 double CauchyDistribution::Sample(std::mt19937& rng) const {
-  std::normal_distribution<double> distribution(0, 1);
+  return SampleImpl(rng);
+}
+
+double CauchyDistribution::Sample(Philox4x32& rng) const {
+  return SampleImpl(rng);
+}
 
-  return x0_ + gamma_ * distribution(rng) / distribution(rng);
+void CauchyDistribution::SampleBatch(std::mt19937& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
+}
+
+void CauchyDistribution::SampleBatch(Philox4x32& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
 }
 
 double CauchyDistribution::TheoreticalMean() const {
@@ -29,4 +76,37 @@ double CauchyDistribution::TheoreticalVariance() const {
   return std::nan("");
 }
 
+double CauchyDistribution::GetX0() const {
+  return x0_;
+}
+
+double CauchyDistribution::GetGamma() const {
+  return gamma_;
+}
+
+template <RandomEngine Engine>
+double CauchyDistribution::SampleImpl(Engine& rng) const {
+  double numerator = StandardNormal(rng);
+
+  return x0_ + gamma_ * numerator / StandardNormal(rng);
+}
+
+template <RandomEngine Engine>
+void CauchyDistribution::SampleBatchImpl(Engine& rng, std::span<double> out) const {
+  std::array<double, kCauchyDenominatorBlockSize> denominators{};
+
+  FillStandardNormal(rng, out);
+
+  for (std::size_t offset = 0; offset < out.size(); offset += denominators.size()) {
+    std::span<double> block = out.subspan(offset, std::min(denominators.size(), out.size() - offset));
+    std::span<double> block_denominators(denominators.data(), block.size());
+
+    FillStandardNormal(rng, block_denominators);
+
+    for (std::size_t i = 0; i < block.size(); ++i) {
+      block[i] = x0_ + gamma_ * block[i] / block_denominators[i];
+    }
+  }
+}
+
 } // namespace ptm
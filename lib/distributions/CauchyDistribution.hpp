@@ -6,22 +6,39 @@
 namespace ptm {
 
 const double kCauchyDistributionX0 = 0.5;
+const std::size_t kCauchyDenominatorBlockSize = 256;
 
 // Распределение Коши (x0, gamma)
-class CauchyDistribution : public Distribution {
+class CauchyDistribution final : public Distribution {
 public:
   CauchyDistribution(double x0, double gamma);
 
   [[nodiscard]] double Pdf(double x) const override;
   [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double p) const override;
+  [[nodiscard]] std::optional<double> SymmetryCenter() const override;
+  void PdfBatch(std::span<const double> x, std::span<double> out) const override;
+  void CdfBatch(std::span<const double> x, std::span<double> out) const override;
   double Sample(std::mt19937& rng) const override;
+  double Sample(Philox4x32& rng) const override;
+  void SampleBatch(std::mt19937& rng, std::span<double> out) const override;
+  void SampleBatch(Philox4x32& rng, std::span<double> out) const override;
 
   [[nodiscard]] double TheoreticalMean() const override;
   [[nodiscard]] double TheoreticalVariance() const override;
 
+  [[nodiscard]] double GetX0() const;
+  [[nodiscard]] double GetGamma() const;
+
 private:
   double x0_;
   double gamma_;
+
+  template <RandomEngine Engine>
+  double SampleImpl(Engine& rng) const;
+
+  template <RandomEngine Engine>
+  void SampleBatchImpl(Engine& rng, std::span<double> out) const;
 };
 
 } // namespace ptm
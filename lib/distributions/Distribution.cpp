@@ -0,0 +1,92 @@
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "Distribution.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Граница расширения отрезка поиска и число шагов бисекции в Quantile по умолчанию
+const double kQuantileSearchLimit = 1e300;
+const int kQuantileBisectionSteps = 2100;
+
+} // namespace
+
+void Distribution::PdfBatch(std::span<const double> x, std::span<double> out) const {
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    out[i] = Pdf(x[i]);
+  }
+}
+
+void Distribution::CdfBatch(std::span<const double> x, std::span<double> out) const {
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    out[i] = Cdf(x[i]);
+  }
+}
+
+double Distribution::Quantile(double p) const {
+  CheckProbability(p);
+
+  if (p == 0)
+    return -std::numeric_limits<double>::infinity();
+
+  double low = -1;
+  double high = 1;
+
+  while (Cdf(low) >= p && low > -kQuantileSearchLimit) {
+    low *= 2;
+  }
+
+  while (Cdf(high) < p) {
+    if (high > kQuantileSearchLimit)
+      return std::numeric_limits<double>::infinity();
+
+    high *= 2;
+  }
+
+  // Инвариант: F(low) < p <= F(high); шагаем, пока между границами есть другие числа double
+  for (int i = 0; i < kQuantileBisectionSteps; ++i) {
+    const double middle = low + (high - low) / 2;
+
+    if (middle <= low || middle >= high)
+      break;
+
+    if (Cdf(middle) >= p)
+      high = middle;
+    else
+      low = middle;
+  }
+
+  return high;
+}
+
+void Distribution::QuantileBatch(std::span<const double> p, std::span<double> out) const {
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    out[i] = Quantile(p[i]);
+  }
+}
+
+void Distribution::CheckProbability(double p) {
+  if (!(p >= 0 && p <= 1))
+    throw std::invalid_argument("Probability must be in [0, 1]");
+}
+
+std::optional<double> Distribution::SymmetryCenter() const {
+  return std::nullopt;
+}
+
+void Distribution::SampleBatch(std::mt19937& rng, std::span<double> out) const {
+  for (double& value : out) {
+    value = Sample(rng);
+  }
+}
+
+void Distribution::SampleBatch(Philox4x32& rng, std::span<double> out) const {
+  for (double& value : out) {
+    value = Sample(rng);
+  }
+}
+
+} // namespace ptm
@@ -1,10 +1,18 @@
 #ifndef PTM_DISTRIBUTION_HPP_
 #define PTM_DISTRIBUTION_HPP_
 
+#include <cstddef>
+#include <optional>
 #include <random>
+#include <span>
+
+#include "random/RandomEngine.hpp"
 
 namespace ptm {
 
+// Размер блока, которым эксперименты запрашивают сэмплы у распределения
+const std::size_t kSampleBatchSize = 4096;
+
 // Базовый класс для распределения
 class Distribution { // NOLINT(cppcoreguidelines-special-member-functions)
 public:
@@ -16,13 +24,38 @@ public:
   // F(x) = P(X <= x)
   [[nodiscard]] virtual double Cdf(double x) const = 0;
 
-  // Генерация выборочного значения
+  // Pdf и Cdf на массиве точек: out[i] = Pdf(x[i]), размеры x и out совпадают.
+  // Непрерывные распределения считают их векторизуемыми ядрами из VectorMath.hpp
+  virtual void PdfBatch(std::span<const double> x, std::span<double> out) const;
+  virtual void CdfBatch(std::span<const double> x, std::span<double> out) const;
+
+  // Квантиль Q(p) = inf{x : F(x) >= p}, p из [0, 1]; Q(0) - нижняя граница носителя.
+  // По умолчанию - бисекция по Cdf, наследники переопределяют явными формулами или поиском по таблицам
+  [[nodiscard]] virtual double Quantile(double p) const;
+  virtual void QuantileBatch(std::span<const double> p, std::span<double> out) const;
+
+  // Центр c, относительно которого X и 2c - X распределены одинаково; nullopt - распределение не симметрично.
+  // Антитетическая пара симметричного распределения - отражение сэмпла, без обращения Cdf
+  [[nodiscard]] virtual std::optional<double> SymmetryCenter() const;
+
+  // Генерация выборочного значения.
+  // Виртуальные функции не бывают шаблонами, поэтому на каждый генератор из RandomEngine - своя перегрузка
   virtual double Sample(std::mt19937& rng) const = 0;
+  virtual double Sample(Philox4x32& rng) const = 0;
+
+  // Заполнение буфера out выборочными значениями.
+  // Наследники настраивают параметры один раз на весь буфер; по умолчанию - поэлементный вызов Sample
+  virtual void SampleBatch(std::mt19937& rng, std::span<double> out) const;
+  virtual void SampleBatch(Philox4x32& rng, std::span<double> out) const;
 
   // Теоретическое матожидание и дисперсия (если определены).
   // Для распределений, где это не определено - можно вернуть NaN.
   [[nodiscard]] virtual double TheoreticalMean() const = 0;
   [[nodiscard]] virtual double TheoreticalVariance() const = 0;
+
+protected:
+  // std::invalid_argument, если p вне [0, 1]
+  static void CheckProbability(double p);
 };
 
 } // namespace ptm
@@ -1,7 +1,6 @@
-#include <algorithm>
-#include <numeric>
-
+#include "AnyDistribution.hpp"
 #include "DistributionExperiment.hpp"
+#include "DistributionExperimentT.hpp"
 
 namespace ptm {
 
@@ -9,62 +8,143 @@ DistributionExperiment::DistributionExperiment(std::shared_ptr<Distribution> dis
     dist_(std::move(dist)), sample_size_(sample_size) {
 }
 
-ExperimentStats DistributionExperiment::Run(std::mt19937& rng) {
-  std::vector<double> values;
+template <RandomEngine Engine>
+ExperimentStats DistributionExperiment::Run(Engine& rng) {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return DistributionExperimentT<D>(std::move(dist), sample_size_).Run(rng);
+  });
+}
 
-  for (std::size_t i = 0; i < sample_size_; ++i) {
-    values.push_back(dist_->Sample(rng));
-  }
+ExperimentStats DistributionExperiment::RunParallel(std::uint64_t seed, std::size_t threads) const {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return DistributionExperimentT<D>(std::move(dist), sample_size_).RunParallel(seed, threads);
+  });
+}
 
-  ExperimentStats result;
+template <RandomEngine Engine>
+ExperimentStats DistributionExperiment::RunQmc(Engine& rng) {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return DistributionExperimentT<D>(std::move(dist), sample_size_).RunQmc(rng);
+  });
+}
 
-  result.empirical_mean = std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(sample_size_);
+template <RandomEngine Engine>
+SequentialStats DistributionExperiment::RunSequential(Engine& rng, const SequentialOptions& options) const {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return DistributionExperimentT<D>(std::move(dist), sample_size_).RunSequential(rng, options);
+  });
+}
 
-  for (double value : values) {
-    result.empirical_variance += std::pow(result.empirical_mean - value, 2);
-  }
+template <RandomEngine Engine>
+VarianceReductionStats DistributionExperiment::RunAntithetic(Engine& rng) const {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return DistributionExperimentT<D>(std::move(dist), sample_size_).RunAntithetic(rng);
+  });
+}
 
-  result.empirical_variance /= static_cast<double>(sample_size_);
-  result.mean_error = result.empirical_mean - dist_->TheoreticalMean();
-  result.variance_error = result.empirical_variance - dist_->TheoreticalVariance();
+template <RandomEngine Engine>
+VarianceReductionStats DistributionExperiment::RunControlVariate(Engine& rng) const {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return DistributionExperimentT<D>(std::move(dist), sample_size_).RunControlVariate(rng);
+  });
+}
 
-  return result;
+template <RandomEngine Engine>
+RqmcStats DistributionExperiment::RunRandomizedQmc(Engine& rng, std::size_t replications) {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return DistributionExperimentT<D>(std::move(dist), sample_size_).RunRandomizedQmc(rng, replications);
+  });
 }
 
+template <RandomEngine Engine>
 std::vector<double> DistributionExperiment::EmpiricalCdf(const std::vector<double>& grid,
-                                                         std::mt19937& rng,
+                                                         Engine& rng,
                                                          std::size_t sample_size) {
-  std::vector<double> values;
-
-  for (std::size_t i = 0; i < sample_size; ++i) {
-    values.push_back(dist_->Sample(rng));
-  }
-
-  std::sort(values.begin(), values.end());
-
-  std::size_t current_value_index = 0;
-  std::vector<double> result;
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return DistributionExperimentT<D>(std::move(dist), sample_size_).EmpiricalCdf(grid, rng, sample_size);
+  });
+}
 
-  for (double point : grid) {
-    while (current_value_index < sample_size && point > values[current_value_index]) {
-      ++current_value_index;
-    }
+std::vector<double> DistributionExperiment::EmpiricalCdfParallel(const std::vector<double>& grid,
+                                                                 std::uint64_t seed,
+                                                                 std::size_t sample_size,
+                                                                 std::size_t threads) const {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    const DistributionExperimentT<D> experiment(std::move(dist), sample_size_);
 
-    result.push_back(static_cast<double>(current_value_index) / static_cast<double>(sample_size_));
-  }
+    return experiment.EmpiricalCdfParallel(grid, seed, sample_size, threads);
+  });
+}
 
-  return result;
+template <RandomEngine Engine>
+GoodnessOfFitResult DistributionExperiment::TestGoodnessOfFit(Engine& rng,
+                                                              std::size_t sample_size,
+                                                              std::size_t threads) const {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return DistributionExperimentT<D>(std::move(dist), sample_size_).TestGoodnessOfFit(rng, sample_size, threads);
+  });
 }
 
 double DistributionExperiment::KolmogorovDistance(const std::vector<double>& grid,
                                                   const std::vector<double>& empirical_cdf) const {
-  double distance = 0;
+  return DistributionExperimentT<Distribution>(dist_, sample_size_).KolmogorovDistance(grid, empirical_cdf);
+}
 
-  for (std::size_t i = 0; i < grid.size(); ++i) {
-    distance = std::max(distance, std::abs(empirical_cdf[i] - dist_->Cdf(grid[i])));
-  }
+template <RandomEngine Engine>
+KllSketch DistributionExperiment::Sketch(Engine& rng, std::size_t sample_size, std::size_t k) const {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return DistributionExperimentT<D>(std::move(dist), sample_size_).Sketch(rng, sample_size, k);
+  });
+}
+
+KllSketch DistributionExperiment::SketchParallel(std::uint64_t seed,
+                                                 std::size_t sample_size,
+                                                 std::size_t threads,
+                                                 std::size_t k) const {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return DistributionExperimentT<D>(std::move(dist), sample_size_).SketchParallel(seed, sample_size, threads, k);
+  });
+}
 
-  return distance;
+double DistributionExperiment::KolmogorovDistance(const KllSketch& sketch) const {
+  return sketch.KolmogorovDistance(*dist_);
 }
 
+template ExperimentStats DistributionExperiment::Run(std::mt19937& rng);
+template ExperimentStats DistributionExperiment::Run(Philox4x32& rng);
+
+template ExperimentStats DistributionExperiment::RunQmc(std::mt19937& rng);
+template ExperimentStats DistributionExperiment::RunQmc(Philox4x32& rng);
+
+template SequentialStats DistributionExperiment::RunSequential(std::mt19937& rng,
+                                                              const SequentialOptions& options) const;
+template SequentialStats DistributionExperiment::RunSequential(Philox4x32& rng,
+                                                              const SequentialOptions& options) const;
+
+template VarianceReductionStats DistributionExperiment::RunAntithetic(std::mt19937& rng) const;
+template VarianceReductionStats DistributionExperiment::RunAntithetic(Philox4x32& rng) const;
+
+template VarianceReductionStats DistributionExperiment::RunControlVariate(std::mt19937& rng) const;
+template VarianceReductionStats DistributionExperiment::RunControlVariate(Philox4x32& rng) const;
+
+template RqmcStats DistributionExperiment::RunRandomizedQmc(std::mt19937& rng, std::size_t replications);
+template RqmcStats DistributionExperiment::RunRandomizedQmc(Philox4x32& rng, std::size_t replications);
+
+template std::vector<double> DistributionExperiment::EmpiricalCdf(const std::vector<double>& grid,
+                                                                  std::mt19937& rng,
+                                                                  std::size_t sample_size);
+template std::vector<double> DistributionExperiment::EmpiricalCdf(const std::vector<double>& grid,
+                                                                  Philox4x32& rng,
+                                                                  std::size_t sample_size);
+
+template GoodnessOfFitResult DistributionExperiment::TestGoodnessOfFit(std::mt19937& rng,
+                                                                       std::size_t sample_size,
+                                                                       std::size_t threads) const;
+template GoodnessOfFitResult DistributionExperiment::TestGoodnessOfFit(Philox4x32& rng,
+                                                                       std::size_t sample_size,
+                                                                       std::size_t threads) const;
+
+template KllSketch DistributionExperiment::Sketch(std::mt19937& rng, std::size_t sample_size, std::size_t k) const;
+template KllSketch DistributionExperiment::Sketch(Philox4x32& rng, std::size_t sample_size, std::size_t k) const;
+
 } // namespace ptm
@@ -3,26 +3,83 @@
 
 #include <memory>
 #include <random>
+#include <vector>
 
 #include "Distribution.hpp"
 #include "ExperimentStats.hpp"
+#include "GoodnessOfFit.hpp"
+#include "KllSketch.hpp"
+#include "RqmcStats.hpp"
+#include "SequentialStats.hpp"
+#include "VarianceReductionStats.hpp"
 
 namespace ptm {
 
-// Класс для массовых экспериментов по моделированию распределений
+// Класс для массовых экспериментов по моделированию распределений.
+// Тип распределения определяется один раз на вызов, дальше работает DistributionExperimentT
 class DistributionExperiment {
 public:
   DistributionExperiment(std::shared_ptr<Distribution> dist, size_t sample_size);
 
-  ExperimentStats Run(std::mt19937& rng);
+  // Генератор - любой из RandomEngine (std::mt19937, Philox4x32)
+  template <RandomEngine Engine>
+  ExperimentStats Run(Engine& rng);
 
-  // Эмпирическая CDF на сетке точек
-  std::vector<double> EmpiricalCdf(const std::vector<double>& grid, std::mt19937& rng, std::size_t sample_size);
+  // Параллельная версия Run с результатом, не зависящим от числа потоков (см. DistributionExperimentT)
+  [[nodiscard]] ExperimentStats RunParallel(std::uint64_t seed, std::size_t threads = 0) const;
+
+  // Квази-Монте-Карло через Quantile и скремблированную последовательность Соболя (см. DistributionExperimentT)
+  template <RandomEngine Engine>
+  ExperimentStats RunQmc(Engine& rng);
+
+  // Партии растущего размера до достижения точности доверительного интервала или исчерпания бюджета;
+  // для распределений без конечной дисперсии - kNonConvergent после первой партии
+  template <RandomEngine Engine>
+  SequentialStats RunSequential(Engine& rng, const SequentialOptions& options) const;
+
+  // Антитетические пары (отражение для симметричных распределений, иначе Quantile(1 - u))
+  template <RandomEngine Engine>
+  VarianceReductionStats RunAntithetic(Engine& rng) const;
+
+  // Управляющая переменная U с известным матожиданием 1/2, X = Quantile(U)
+  template <RandomEngine Engine>
+  VarianceReductionStats RunControlVariate(Engine& rng) const;
+
+  // Рандомизированный QMC: replications независимых скремблирований и стандартные ошибки оценок
+  template <RandomEngine Engine>
+  RqmcStats RunRandomizedQmc(Engine& rng, std::size_t replications);
+
+  // Эмпирическая CDF F_n(x) = #{X_i <= x} / sample_size в узлах отсортированной сетки, O(G) памяти
+  template <RandomEngine Engine>
+  std::vector<double> EmpiricalCdf(const std::vector<double>& grid, Engine& rng, std::size_t sample_size);
+
+  // То же на threads потоках, результат не зависит от их числа
+  [[nodiscard]] std::vector<double> EmpiricalCdfParallel(const std::vector<double>& grid,
+                                                         std::uint64_t seed,
+                                                         std::size_t sample_size,
+                                                         std::size_t threads = 0) const;
+
+  // KS (D_n и p-value), Андерсон-Дарлинг и Крамер-фон Мизес по одной отсортированной выборке
+  template <RandomEngine Engine>
+  GoodnessOfFitResult TestGoodnessOfFit(Engine& rng, std::size_t sample_size, std::size_t threads = 0) const;
 
   // Оценка статистики Колмогорова между эмпирической и теоретической CDF
   [[nodiscard]] double KolmogorovDistance(const std::vector<double>& grid,
                                           const std::vector<double>& empirical_cdf) const;
 
+  // KLL-эскиз выборки: приближённая эмпирическая CDF с ограниченной памятью (см. DistributionExperimentT)
+  template <RandomEngine Engine>
+  KllSketch Sketch(Engine& rng, std::size_t sample_size, std::size_t k = kKllDefaultK) const;
+
+  // Параллельный эскиз, не зависящий от числа потоков
+  [[nodiscard]] KllSketch SketchParallel(std::uint64_t seed,
+                                         std::size_t sample_size,
+                                         std::size_t threads = 0,
+                                         std::size_t k = kKllDefaultK) const;
+
+  // Статистика Колмогорова по эскизу
+  [[nodiscard]] double KolmogorovDistance(const KllSketch& sketch) const;
+
 private:
   std::shared_ptr<Distribution> dist_;
   std::size_t sample_size_;
@@ -0,0 +1,612 @@
+#ifndef PTM_DISTRIBUTIONEXPERIMENTT_HPP_
+#define PTM_DISTRIBUTIONEXPERIMENTT_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Distribution.hpp"
+#include "ExperimentStats.hpp"
+#include "GoodnessOfFit.hpp"
+#include "GridBinning.hpp"
+#include "KllSketch.hpp"
+#include "MomentAccumulator.hpp"
+#include "ParallelFor.hpp"
+#include "RandomBits.hpp"
+#include "RqmcStats.hpp"
+#include "SequentialStats.hpp"
+#include "VarianceReductionStats.hpp"
+#include "random/Philox4x32.hpp"
+#include "random/SobolSequence.hpp"
+
+namespace ptm {
+
+// Сэмплов в блоке параллельного эксперимента. Размер фиксирован, чтобы разбиение на блоки,
+// а с ним и результат, не зависели от числа потоков
+const std::size_t kParallelBlockSize = std::size_t{1} << 16;
+
+// Эскизов блоков на поток, одновременно живущих в SketchParallel
+const std::size_t kSketchWaveBlocksPerThread = 4;
+
+// Эксперимент над распределением известного на этапе компиляции типа D.
+// Для final-наследников Distribution вызовы SampleBatch/CdfBatch не виртуальные;
+// D = Distribution - обычная полиморфная версия
+template <class D>
+  requires std::derived_from<D, Distribution>
+class DistributionExperimentT {
+public:
+  DistributionExperimentT(std::shared_ptr<const D> dist, std::size_t sample_size);
+
+  template <RandomEngine Engine>
+  ExperimentStats Run(Engine& rng) const;
+
+  // Параллельный Run: выборка режется на блоки по kParallelBlockSize, блок b генерируется
+  // Philox4x32(seed, b) в свой MomentAccumulator, аккумуляторы сливаются по порядку блоков.
+  // Результат побитово одинаков при любом threads (0 - по числу ядер)
+  [[nodiscard]] ExperimentStats RunParallel(std::uint64_t seed, std::size_t threads = 0) const;
+
+  // Квази-Монте-Карло: X_i = Quantile(u_i), где u_i - точки скремблированной последовательности Соболя,
+  // а seed скремблирования берётся из rng. Для гладких распределений ошибка убывает почти как 1/N
+  // вместо 1/sqrt(N); sample_size лучше брать степенью двойки. sample_size больше периода последовательности
+  // kSobolSequencePeriod = 2^32 - std::invalid_argument
+  template <RandomEngine Engine>
+  ExperimentStats RunQmc(Engine& rng) const;
+
+  // Последовательный эксперимент: партии растут в options.growth_factor раз, после каждой пересчитывается
+  // полуширина нормального доверительного интервала для матожидания. Останавливается при достижении
+  // точности или исчерпании options.max_samples; sample_size не используется
+  template <RandomEngine Engine>
+  SequentialStats RunSequential(Engine& rng, const SequentialOptions& options) const;
+
+  // Антитетические пары из sample_size / 2 пар: для симметричного распределения (SymmetryCenter) -
+  // сэмпл X и его отражение 2c - X, иначе Quantile(u) и Quantile(1 - u). Оценка матожидания -
+  // среднее пар, её стандартная ошибка - по разбросу средних пар
+  template <RandomEngine Engine>
+  VarianceReductionStats RunAntithetic(Engine& rng) const;
+
+  // Управляющая переменная: X = Quantile(U), оценка матожидания mean(X) - beta * (mean(U) - 1/2)
+  // с beta = Cov(X, U) / Var(U). Дисперсия оценки меньше в 1 / (1 - rho^2) раз, rho = Corr(X, U)
+  template <RandomEngine Engine>
+  VarianceReductionStats RunControlVariate(Engine& rng) const;
+
+  // replications независимых скремблирований RunQmc с оценкой стандартной ошибки по их разбросу
+  template <RandomEngine Engine>
+  RqmcStats RunRandomizedQmc(Engine& rng, std::size_t replications) const;
+
+  // Эмпирическая CDF F_n(x) = #{X_i <= x} / sample_size в узлах отсортированной сетки.
+  // Сэмплы не хранятся: каждый раскладывается по ячейкам сетки (GridBinning), O(N log G) времени
+  // и O(G) памяти
+  template <RandomEngine Engine>
+  std::vector<double> EmpiricalCdf(const std::vector<double>& grid, Engine& rng, std::size_t sample_size) const;
+
+  // То же на threads потоках; блоки и их генераторы - как в RunParallel, счётчики ячеек складываются,
+  // поэтому результат не зависит от числа потоков
+  [[nodiscard]] std::vector<double> EmpiricalCdfParallel(const std::vector<double>& grid,
+                                                         std::uint64_t seed,
+                                                         std::size_t sample_size,
+                                                         std::size_t threads = 0) const;
+
+  // Критерии согласия (KS с точным и асимптотическим p-value, A^2, W^2) по выборке из sample_size
+  // значений: одна параллельная сортировка и один проход по CdfBatch на все три критерия
+  template <RandomEngine Engine>
+  GoodnessOfFitResult TestGoodnessOfFit(Engine& rng, std::size_t sample_size, std::size_t threads = 0) const;
+
+  // Оценка статистики Колмогорова между эмпирической и теоретической CDF
+  [[nodiscard]] double KolmogorovDistance(const std::vector<double>& grid,
+                                          const std::vector<double>& empirical_cdf) const;
+
+  // KLL-эскиз выборки из sample_size значений: O(k log(N / k)) памяти при любом N.
+  // Приближённая эмпирическая CDF - sketch.Cdf(grid), ошибка ранга - sketch.NormalizedRankError()
+  template <RandomEngine Engine>
+  KllSketch Sketch(Engine& rng, std::size_t sample_size, std::size_t k = kKllDefaultK) const;
+
+  // То же на threads потоках: эскизы блоков (блоки и генераторы - как в RunParallel) сливаются
+  // по порядку блоков, поэтому эскиз не зависит от числа потоков. Одновременно хранится не больше
+  // kSketchWaveBlocksPerThread * threads эскизов блоков
+  [[nodiscard]] KllSketch SketchParallel(std::uint64_t seed,
+                                         std::size_t sample_size,
+                                         std::size_t threads = 0,
+                                         std::size_t k = kKllDefaultK) const;
+
+  // Статистика Колмогорова по эскизу; от точной D_n отличается не больше чем на ошибку ранга
+  [[nodiscard]] double KolmogorovDistance(const KllSketch& sketch) const;
+
+private:
+  std::shared_ptr<const D> dist_;
+  std::size_t sample_size_;
+
+  ExperimentStats Summarize(const MomentAccumulator& moments) const;
+};
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+DistributionExperimentT<D>::DistributionExperimentT(std::shared_ptr<const D> dist, std::size_t sample_size) :
+    dist_(std::move(dist)), sample_size_(sample_size) {
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+ExperimentStats DistributionExperimentT<D>::Run(Engine& rng) const {
+  // Один проход блоками по kSampleBatchSize: память O(1) при любом sample_size_
+  std::vector<double> block(std::min(kSampleBatchSize, sample_size_));
+  MomentAccumulator moments;
+
+  for (std::size_t offset = 0; offset < sample_size_; offset += kSampleBatchSize) {
+    std::span<double> chunk(block.data(), std::min(kSampleBatchSize, sample_size_ - offset));
+    dist_->SampleBatch(rng, chunk);
+    moments.AddBatch(chunk);
+  }
+
+  return Summarize(moments);
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+ExperimentStats DistributionExperimentT<D>::RunParallel(std::uint64_t seed, std::size_t threads) const {
+  const std::size_t blocks = (sample_size_ + kParallelBlockSize - 1) / kParallelBlockSize;
+  std::vector<MomentAccumulator> partial(blocks);
+
+  ParallelFor(blocks, threads, [&](std::size_t b) {
+    Philox4x32 rng(seed, b);
+    const std::size_t begin = b * kParallelBlockSize;
+    const std::size_t end = std::min(begin + kParallelBlockSize, sample_size_);
+    std::vector<double> chunk_buffer(std::min(kSampleBatchSize, end - begin));
+
+    for (std::size_t offset = begin; offset < end; offset += kSampleBatchSize) {
+      std::span<double> chunk(chunk_buffer.data(), std::min(kSampleBatchSize, end - offset));
+      dist_->SampleBatch(rng, chunk);
+      partial[b].AddBatch(chunk);
+    }
+  });
+
+  MomentAccumulator moments;
+
+  for (const MomentAccumulator& block : partial) {
+    moments.Merge(block);
+  }
+
+  return Summarize(moments);
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+ExperimentStats DistributionExperimentT<D>::RunQmc(Engine& rng) const {
+  if (sample_size_ > kSobolSequencePeriod)
+    throw std::invalid_argument("QMC sample size exceeds the Sobol sequence period");
+
+  const SobolSequence sequence(static_cast<std::uint32_t>(rng()));
+  std::vector<double> block(std::min(kSampleBatchSize, sample_size_));
+  MomentAccumulator moments;
+
+  for (std::size_t offset = 0; offset < sample_size_; offset += kSampleBatchSize) {
+    std::span<double> chunk(block.data(), std::min(kSampleBatchSize, sample_size_ - offset));
+    sequence.Fill(static_cast<std::uint32_t>(offset), chunk);
+    dist_->QuantileBatch(chunk, chunk);
+    moments.AddBatch(chunk);
+  }
+
+  return Summarize(moments);
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+SequentialStats DistributionExperimentT<D>::RunSequential(Engine& rng, const SequentialOptions& options) const {
+  if (options.absolute_precision <= 0 && options.relative_precision <= 0)
+    throw std::invalid_argument("Sequential experiment needs a positive target precision");
+
+  if (options.initial_batch < 2 || !std::isfinite(options.growth_factor) || options.growth_factor < 1 ||
+      options.max_samples < options.initial_batch)
+    throw std::invalid_argument("Invalid sequential experiment batches");
+
+  if (!(options.confidence_level > 0 && options.confidence_level < 1))
+    throw std::invalid_argument("Confidence level must lie in (0, 1)");
+
+  const double z = StandardNormalQuantile((1 + options.confidence_level) / 2);
+  const bool finite_variance = std::isfinite(dist_->TheoreticalVariance());
+  std::vector<double> block(kSampleBatchSize);
+  MomentAccumulator moments;
+  SequentialStats result;
+  auto batch = static_cast<double>(options.initial_batch);
+
+  while (true) {
+    // Сравнение в double до приведения: при большом growth_factor batch выходит за пределы size_t
+    const std::size_t remaining = options.max_samples - moments.Count();
+    const auto batch_size = batch < static_cast<double>(remaining) ? static_cast<std::size_t>(batch) : remaining;
+
+    for (std::size_t offset = 0; offset < batch_size; offset += kSampleBatchSize) {
+      std::span<double> chunk(block.data(), std::min(kSampleBatchSize, batch_size - offset));
+      dist_->SampleBatch(rng, chunk);
+      moments.AddBatch(chunk);
+    }
+
+    ++result.batches;
+    const auto count = static_cast<double>(moments.Count());
+    result.half_width = z * std::sqrt(moments.Variance() / (count - 1));
+
+    if (!finite_variance || !std::isfinite(result.half_width)) {
+      result.status = SequentialStatus::kNonConvergent;
+      break;
+    }
+
+    const bool absolute_met = options.absolute_precision > 0 && result.half_width <= options.absolute_precision;
+    const bool relative_met =
+        options.relative_precision > 0 && result.half_width <= options.relative_precision * std::abs(moments.Mean());
+
+    if (absolute_met || relative_met) {
+      result.status = SequentialStatus::kConverged;
+      break;
+    }
+
+    if (moments.Count() >= options.max_samples) {
+      result.status = SequentialStatus::kBudgetExhausted;
+      break;
+    }
+
+    batch *= options.growth_factor;
+  }
+
+  result.stats = Summarize(moments);
+  result.samples_used = moments.Count();
+
+  return result;
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+VarianceReductionStats DistributionExperimentT<D>::RunAntithetic(Engine& rng) const {
+  const std::size_t pairs = sample_size_ / 2;
+
+  if (pairs < 2)
+    throw std::invalid_argument("Antithetic sampling needs at least two pairs");
+
+  const std::optional<double> center = dist_->SymmetryCenter();
+  const std::size_t block_pairs = kSampleBatchSize / 2;
+  std::vector<double> first(std::min(block_pairs, pairs));
+  std::vector<double> second(first.size());
+  MomentAccumulator values;
+  MomentAccumulator pair_means;
+
+  for (std::size_t offset = 0; offset < pairs; offset += block_pairs) {
+    const std::size_t count = std::min(block_pairs, pairs - offset);
+    std::span<double> x(first.data(), count);
+    std::span<double> y(second.data(), count);
+
+    if (center) {
+      dist_->SampleBatch(rng, x);
+
+      for (std::size_t i = 0; i < count; ++i) {
+        y[i] = 2 * *center - x[i];
+      }
+    } else {
+      for (std::size_t i = 0; i < count; ++i) {
+        x[i] = BitsToOpenInterval(NextBits64(rng));
+        y[i] = 1 - x[i];
+      }
+
+      dist_->QuantileBatch(x, x);
+      dist_->QuantileBatch(y, y);
+    }
+
+    values.AddBatch(x);
+    values.AddBatch(y);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      x[i] = (x[i] + y[i]) / 2;
+    }
+
+    pair_means.AddBatch(x);
+  }
+
+  VarianceReductionStats result;
+  result.stats = Summarize(values);
+  result.stats.empirical_mean = pair_means.Mean();
+  result.stats.mean_error = result.stats.empirical_mean - dist_->TheoreticalMean();
+
+  // Variance() делит на n, поэтому s^2 / n = Variance() / (n - 1)
+  const auto total = static_cast<double>(values.Count());
+  result.mean_standard_error = std::sqrt(pair_means.Variance() / static_cast<double>(pairs - 1));
+  result.plain_standard_error = std::sqrt(values.Variance() / (total - 1));
+  result.variance_reduction = result.plain_standard_error * result.plain_standard_error /
+                              (result.mean_standard_error * result.mean_standard_error);
+
+  return result;
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+VarianceReductionStats DistributionExperimentT<D>::RunControlVariate(Engine& rng) const {
+  if (sample_size_ < 3)
+    throw std::invalid_argument("Control variate needs at least three samples");
+
+  std::vector<double> uniforms(std::min(kSampleBatchSize, sample_size_));
+  std::vector<double> block(uniforms.size());
+  MomentAccumulator values;
+
+  // Средние и суммы (co)моментов пары (X, U), блоки сливаются по формулам Chan
+  double count = 0;
+  double mean_x = 0;
+  double mean_u = 0;
+  double m2_u = 0;
+  double co_moment = 0;
+
+  for (std::size_t offset = 0; offset < sample_size_; offset += kSampleBatchSize) {
+    const std::size_t size = std::min(kSampleBatchSize, sample_size_ - offset);
+    std::span<double> u(uniforms.data(), size);
+    std::span<double> x(block.data(), size);
+
+    for (double& value : u) {
+      value = BitsToOpenInterval(NextBits64(rng));
+    }
+
+    dist_->QuantileBatch(u, x);
+    values.AddBatch(x);
+
+    const auto block_count = static_cast<double>(size);
+    double block_mean_x = 0;
+    double block_mean_u = 0;
+
+    for (std::size_t i = 0; i < size; ++i) {
+      block_mean_x += x[i];
+      block_mean_u += u[i];
+    }
+
+    block_mean_x /= block_count;
+    block_mean_u /= block_count;
+    double block_m2_u = 0;
+    double block_co_moment = 0;
+
+    for (std::size_t i = 0; i < size; ++i) {
+      block_m2_u += (u[i] - block_mean_u) * (u[i] - block_mean_u);
+      block_co_moment += (x[i] - block_mean_x) * (u[i] - block_mean_u);
+    }
+
+    const double merged = count + block_count;
+    const double delta_x = block_mean_x - mean_x;
+    const double delta_u = block_mean_u - mean_u;
+    const double weight = count * block_count / merged;
+    m2_u += block_m2_u + delta_u * delta_u * weight;
+    co_moment += block_co_moment + delta_x * delta_u * weight;
+    mean_x += delta_x * block_count / merged;
+    mean_u += delta_u * block_count / merged;
+    count = merged;
+  }
+
+  const double beta = co_moment / m2_u;
+  const double m2_x = values.Variance() * count;
+
+  VarianceReductionStats result;
+  result.stats = Summarize(values);
+  result.stats.empirical_mean = mean_x - beta * (mean_u - 0.5);
+  result.stats.mean_error = result.stats.empirical_mean - dist_->TheoreticalMean();
+
+  // Остаточная дисперсия X - beta * U; beta оценена по той же выборке, отсюда n - 2 степени свободы
+  result.mean_standard_error = std::sqrt((m2_x - beta * co_moment) / (count - 2) / count);
+  result.plain_standard_error = std::sqrt(m2_x / (count - 1) / count);
+  result.variance_reduction = result.plain_standard_error * result.plain_standard_error /
+                              (result.mean_standard_error * result.mean_standard_error);
+
+  return result;
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+RqmcStats DistributionExperimentT<D>::RunRandomizedQmc(Engine& rng, std::size_t replications) const {
+  if (replications < 2)
+    throw std::invalid_argument("Randomized QMC needs at least two replications");
+
+  std::vector<ExperimentStats> runs;
+
+  for (std::size_t r = 0; r < replications; ++r) {
+    runs.push_back(RunQmc(rng));
+  }
+
+  const auto count = static_cast<double>(replications);
+  RqmcStats result;
+  result.replications = replications;
+
+  for (const ExperimentStats& run : runs) {
+    result.stats.empirical_mean += run.empirical_mean / count;
+    result.stats.empirical_variance += run.empirical_variance / count;
+  }
+
+  for (const ExperimentStats& run : runs) {
+    const double mean_deviation = run.empirical_mean - result.stats.empirical_mean;
+    const double variance_deviation = run.empirical_variance - result.stats.empirical_variance;
+    result.mean_standard_error += mean_deviation * mean_deviation;
+    result.variance_standard_error += variance_deviation * variance_deviation;
+  }
+
+  // Повторы независимы и несмещены, поэтому SE = s / sqrt(R)
+  result.mean_standard_error = std::sqrt(result.mean_standard_error / (count - 1) / count);
+  result.variance_standard_error = std::sqrt(result.variance_standard_error / (count - 1) / count);
+  result.stats.mean_error = result.stats.empirical_mean - dist_->TheoreticalMean();
+  result.stats.variance_error = result.stats.empirical_variance - dist_->TheoreticalVariance();
+
+  return result;
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+std::vector<double> DistributionExperimentT<D>::EmpiricalCdf(const std::vector<double>& grid,
+                                                             Engine& rng,
+                                                             std::size_t sample_size) const {
+  const GridBinning binning(grid);
+  std::vector<std::uint64_t> counts(grid.size() + 1);
+  std::vector<double> block(std::min(kSampleBatchSize, sample_size));
+
+  for (std::size_t offset = 0; offset < sample_size; offset += kSampleBatchSize) {
+    std::span<double> chunk(block.data(), std::min(kSampleBatchSize, sample_size - offset));
+    dist_->SampleBatch(rng, chunk);
+    binning.Count(chunk, counts);
+  }
+
+  return binning.Cdf(counts, sample_size);
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+std::vector<double> DistributionExperimentT<D>::EmpiricalCdfParallel(const std::vector<double>& grid,
+                                                                     std::uint64_t seed,
+                                                                     std::size_t sample_size,
+                                                                     std::size_t threads) const {
+  const GridBinning binning(grid);
+  const std::size_t blocks = (sample_size + kParallelBlockSize - 1) / kParallelBlockSize;
+  std::vector<std::uint64_t> counts(grid.size() + 1);
+  std::mutex counts_mutex;
+
+  ParallelFor(blocks, threads, [&](std::size_t b) {
+    Philox4x32 rng(seed, b);
+    const std::size_t begin = b * kParallelBlockSize;
+    const std::size_t end = std::min(begin + kParallelBlockSize, sample_size);
+    std::vector<double> chunk_buffer(std::min(kSampleBatchSize, end - begin));
+    std::vector<std::uint64_t> block_counts(grid.size() + 1);
+
+    for (std::size_t offset = begin; offset < end; offset += kSampleBatchSize) {
+      std::span<double> chunk(chunk_buffer.data(), std::min(kSampleBatchSize, end - offset));
+      dist_->SampleBatch(rng, chunk);
+      binning.Count(chunk, block_counts);
+    }
+
+    std::lock_guard lock(counts_mutex);
+
+    for (std::size_t j = 0; j < counts.size(); ++j) {
+      counts[j] += block_counts[j];
+    }
+  });
+
+  return binning.Cdf(counts, sample_size);
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+GoodnessOfFitResult DistributionExperimentT<D>::TestGoodnessOfFit(Engine& rng,
+                                                                  std::size_t sample_size,
+                                                                  std::size_t threads) const {
+  std::vector<double> sample(sample_size);
+
+  for (std::size_t offset = 0; offset < sample_size; offset += kSampleBatchSize) {
+    const std::size_t count = std::min(kSampleBatchSize, sample_size - offset);
+    dist_->SampleBatch(rng, std::span<double>(sample).subspan(offset, count));
+  }
+
+  return GoodnessOfFit(*dist_, sample, threads);
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+double DistributionExperimentT<D>::KolmogorovDistance(const std::vector<double>& grid,
+                                                      const std::vector<double>& empirical_cdf) const {
+  std::vector<double> theoretical_cdf(grid.size());
+  dist_->CdfBatch(grid, theoretical_cdf);
+
+  double distance = 0;
+
+  for (std::size_t i = 0; i < grid.size(); ++i) {
+    distance = std::max(distance, std::abs(empirical_cdf[i] - theoretical_cdf[i]));
+  }
+
+  return distance;
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+KllSketch DistributionExperimentT<D>::Sketch(Engine& rng, std::size_t sample_size, std::size_t k) const {
+  KllSketch sketch(k, rng());
+  std::vector<double> block(std::min(kSampleBatchSize, sample_size));
+
+  for (std::size_t offset = 0; offset < sample_size; offset += kSampleBatchSize) {
+    std::span<double> chunk(block.data(), std::min(kSampleBatchSize, sample_size - offset));
+    dist_->SampleBatch(rng, chunk);
+    sketch.UpdateBatch(chunk);
+  }
+
+  return sketch;
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+KllSketch DistributionExperimentT<D>::SketchParallel(std::uint64_t seed,
+                                                     std::size_t sample_size,
+                                                     std::size_t threads,
+                                                     std::size_t k) const {
+  const std::size_t blocks = (sample_size + kParallelBlockSize - 1) / kParallelBlockSize;
+
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+
+  // Блоки обрабатываются волнами по kSketchWaveBlocksPerThread * threads: эскизы волны сливаются в общий
+  // по порядку блоков до начала следующей, так что память - O(threads * k log(n / k)), а не O(n / kParallelBlockSize)
+  const std::size_t wave = std::min(blocks, kSketchWaveBlocksPerThread * threads);
+  std::vector<KllSketch> partial(wave, KllSketch(k));
+  KllSketch sketch(k, ~seed);
+
+  for (std::size_t first = 0; first < blocks; first += wave) {
+    const std::size_t count = std::min(wave, blocks - first);
+
+    ParallelFor(count, threads, [&](std::size_t i) {
+      const std::size_t b = first + i;
+      Philox4x32 rng(seed, b);
+      const std::size_t begin = b * kParallelBlockSize;
+      const std::size_t end = std::min(begin + kParallelBlockSize, sample_size);
+      std::vector<double> chunk_buffer(std::min(kSampleBatchSize, end - begin));
+
+      // Монета эскиза блока b берётся с другим ключом Philox, чем его сэмплы
+      partial[i] = KllSketch(k, ~seed + b);
+
+      for (std::size_t offset = begin; offset < end; offset += kSampleBatchSize) {
+        std::span<double> chunk(chunk_buffer.data(), std::min(kSampleBatchSize, end - offset));
+        dist_->SampleBatch(rng, chunk);
+        partial[i].UpdateBatch(chunk);
+      }
+    });
+
+    for (std::size_t i = 0; i < count; ++i) {
+      sketch.Merge(partial[i]);
+    }
+  }
+
+  return sketch;
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+double DistributionExperimentT<D>::KolmogorovDistance(const KllSketch& sketch) const {
+  return sketch.KolmogorovDistance(*dist_);
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+ExperimentStats DistributionExperimentT<D>::Summarize(const MomentAccumulator& moments) const {
+  ExperimentStats result;
+
+  result.empirical_mean = moments.Mean();
+  result.empirical_variance = moments.Variance();
+  result.mean_error = result.empirical_mean - dist_->TheoreticalMean();
+  result.variance_error = result.empirical_variance - dist_->TheoreticalVariance();
+  result.skewness = moments.Skewness();
+  result.kurtosis = moments.Kurtosis();
+  result.min = moments.Min();
+  result.max = moments.Max();
+
+  return result;
+}
+
+} // namespace ptm
+
+#endif // PTM_DISTRIBUTIONEXPERIMENTT_HPP_
@@ -6,6 +6,10 @@ struct ExperimentStats {
   double empirical_variance = 0.0;
   double mean_error = 0.0;
   double variance_error = 0.0;
+  double skewness = 0.0; // коэффициент асимметрии
+  double kurtosis = 0.0; // эксцесс (kurtosis - 3)
+  double min = 0.0;
+  double max = 0.0;
 };
 
 #endif // PTM_EXPERIMENTSTATS_HPP_
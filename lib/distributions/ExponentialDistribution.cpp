@@ -1,4 +1,8 @@
+#include <cmath>
+
 #include "ExponentialDistribution.hpp"
+#include "VectorMath.hpp"
+#include "Ziggurat.hpp"
 
 namespace ptm {
 
@@ -13,13 +17,44 @@ double ExponentialDistribution::Pdf(double x) const {
 }
 
 double ExponentialDistribution::Cdf(double x) const {
+  if (x < 0)
+    return 0;
+
   return 1 - std::exp(-lambda_ * x);
 }
 
+double ExponentialDistribution::Quantile(double p) const {
+  CheckProbability(p);
+
+  return -std::log1p(-p) / lambda_;
+}
+
+void ExponentialDistribution::PdfBatch(std::span<const double> x, std::span<double> out) const {
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    out[i] = x[i] < 0 ? 0.0 : lambda_ * FastExp(-lambda_ * x[i]);
+  }
+}
+
+void ExponentialDistribution::CdfBatch(std::span<const double> x, std::span<double> out) const {
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    out[i] = x[i] < 0 ? 0.0 : 1 - FastExp(-lambda_ * x[i]);
+  }
+}
+
 double ExponentialDistribution::Sample(std::mt19937& rng) const {
-  std::exponential_distribution distribution(lambda_);
+  return SampleImpl(rng);
+}
 
-  return distribution(rng);
+double ExponentialDistribution::Sample(Philox4x32& rng) const {
+  return SampleImpl(rng);
+}
+
+void ExponentialDistribution::SampleBatch(std::mt19937& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
+}
+
+void ExponentialDistribution::SampleBatch(Philox4x32& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
 }
 
 double ExponentialDistribution::TheoreticalMean() const {
@@ -30,4 +65,22 @@ double ExponentialDistribution::TheoreticalVariance() const {
   return 1 / std::pow(lambda_, 2);
 }
 
+double ExponentialDistribution::GetLambda() const {
+  return lambda_;
+}
+
+template <RandomEngine Engine>
+double ExponentialDistribution::SampleImpl(Engine& rng) const {
+  return StandardExponential(rng) / lambda_;
+}
+
+template <RandomEngine Engine>
+void ExponentialDistribution::SampleBatchImpl(Engine& rng, std::span<double> out) const {
+  FillStandardExponential(rng, out);
+
+  for (double& value : out) {
+    value /= lambda_;
+  }
+}
+
 } // namespace ptm
@@ -5,19 +5,33 @@
 
 namespace ptm {
 
-class ExponentialDistribution : public Distribution {
+class ExponentialDistribution final : public Distribution {
 public:
   explicit ExponentialDistribution(double lambda);
 
   [[nodiscard]] double Pdf(double x) const override;
   [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double p) const override;
+  void PdfBatch(std::span<const double> x, std::span<double> out) const override;
+  void CdfBatch(std::span<const double> x, std::span<double> out) const override;
   double Sample(std::mt19937& rng) const override;
+  double Sample(Philox4x32& rng) const override;
+  void SampleBatch(std::mt19937& rng, std::span<double> out) const override;
+  void SampleBatch(Philox4x32& rng, std::span<double> out) const override;
 
   [[nodiscard]] double TheoreticalMean() const override;
   [[nodiscard]] double TheoreticalVariance() const override;
 
+  [[nodiscard]] double GetLambda() const;
+
 private:
   double lambda_;
+
+  template <RandomEngine Engine>
+  double SampleImpl(Engine& rng) const;
+
+  template <RandomEngine Engine>
+  void SampleBatchImpl(Engine& rng, std::span<double> out) const;
 };
 
 } // namespace ptm
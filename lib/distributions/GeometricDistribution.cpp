@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "GeometricDistribution.hpp"
 
 namespace ptm {
@@ -19,10 +23,40 @@ double GeometricDistribution::Cdf(double x) const {
   return 1 - std::pow(1 - p_, std::floor(x));
 }
 
+double GeometricDistribution::Quantile(double p) const {
+  CheckProbability(p);
+
+  if (p == 1)
+    return p_ == 1 ? 1 : std::numeric_limits<double>::infinity();
+
+  // Наименьшее k с 1 - (1 - p_)^k >= p; формула может ошибиться на единицу из-за округления
+  double k = std::max(1.0, std::ceil(std::log1p(-p) / std::log1p(-p_)));
+
+  while (k > 1 && Cdf(k - 1) >= p) {
+    --k;
+  }
+
+  while (Cdf(k) < p) {
+    ++k;
+  }
+
+  return k;
+}
+
 double GeometricDistribution::Sample(std::mt19937& rng) const {
-  std::geometric_distribution<std::uint32_t> distribution(p_);
+  return SampleImpl(rng);
+}
+
+double GeometricDistribution::Sample(Philox4x32& rng) const {
+  return SampleImpl(rng);
+}
 
-  return distribution(rng);
+void GeometricDistribution::SampleBatch(std::mt19937& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
+}
+
+void GeometricDistribution::SampleBatch(Philox4x32& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
 }
 
 double GeometricDistribution::TheoreticalMean() const {
@@ -33,4 +67,25 @@ double GeometricDistribution::TheoreticalVariance() const {
   return (1 - p_) / std::pow(p_, 2);
 }
 
+double GeometricDistribution::GetP() const {
+  return p_;
+}
+
+template <RandomEngine Engine>
+double GeometricDistribution::SampleImpl(Engine& rng) const {
+  std::geometric_distribution<std::uint32_t> distribution(p_);
+
+  // std::geometric_distribution считает неудачи до первого успеха, носитель у нас {1, 2, ...}
+  return distribution(rng) + 1;
+}
+
+template <RandomEngine Engine>
+void GeometricDistribution::SampleBatchImpl(Engine& rng, std::span<double> out) const {
+  std::geometric_distribution<std::uint32_t> distribution(p_);
+
+  for (double& value : out) {
+    value = distribution(rng) + 1;
+  }
+}
+
 } // namespace ptm
@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include "GoodnessOfFit.hpp"
+#include "ParallelFor.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Граница между двумя рядами распределения Колмогорова и число их членов
+const double kKolmogorovSeriesBorder = 1.18;
+const int kKolmogorovSeriesTerms = 100;
+
+// Границы n d^2, с которых MTW заменяют точный расчёт приближением
+const double kKolmogorovFarTail = 7.24;
+const double kKolmogorovFarTailLarge = 3.76;
+const std::size_t kKolmogorovLargeSize = 99;
+
+// Масштаб, которым MTW удерживает элементы степени матрицы в диапазоне double
+const double kMatrixScale = 1e140;
+const int kMatrixScaleExponent = 140;
+
+// Для A^2: F(x) отодвигается от 0 и 1, чтобы логарифмы оставались конечными
+const double kMinCdf = std::numeric_limits<double>::min();
+const double kMaxCdf = 1 - std::numeric_limits<double>::epsilon() / 2;
+
+using Matrix = std::vector<double>;
+
+Matrix Multiply(const Matrix& a, const Matrix& b, std::size_t m) {
+  Matrix c(m * m);
+
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t k = 0; k < m; ++k) {
+      const double a_ik = a[i * m + k];
+
+      for (std::size_t j = 0; j < m; ++j) {
+        c[i * m + j] += a_ik * b[k * m + j];
+      }
+    }
+  }
+
+  return c;
+}
+
+// a^n с показателем масштаба: результат = matrix * 10^exponent
+void Power(const Matrix& a, std::size_t m, std::size_t n, Matrix& result, int& exponent) {
+  if (n == 0) {
+    result.assign(m * m, 0);
+
+    for (std::size_t i = 0; i < m; ++i) {
+      result[i * m + i] = 1;
+    }
+
+    exponent = 0;
+    return;
+  }
+
+  if (n == 1) {
+    result = a;
+    exponent = 0;
+    return;
+  }
+
+  Power(a, m, n / 2, result, exponent);
+  Matrix square = Multiply(result, result, m);
+  exponent *= 2;
+
+  if (n % 2 == 0)
+    result = std::move(square);
+  else
+    result = Multiply(a, square, m);
+
+  if (result[(m / 2) * m + m / 2] > kMatrixScale) {
+    for (double& value : result) {
+      value /= kMatrixScale;
+    }
+
+    exponent += kMatrixScaleExponent;
+  }
+}
+
+} // namespace
+
+double KolmogorovAsymptoticPValue(double lambda) {
+  if (lambda <= 0)
+    return 1;
+
+  double sum = 0;
+
+  if (lambda < kKolmogorovSeriesBorder) {
+    // K(lambda) = sqrt(2 pi) / lambda * sum exp(-(2k - 1)^2 pi^2 / (8 lambda^2))
+    const double factor = -std::numbers::pi * std::numbers::pi / (8 * lambda * lambda);
+
+    for (int k = 1; k <= kKolmogorovSeriesTerms; ++k) {
+      const double term = std::exp(factor * (2 * k - 1) * (2 * k - 1));
+      sum += term;
+
+      if (term < std::numeric_limits<double>::epsilon() * sum)
+        break;
+    }
+
+    return 1 - std::sqrt(2 * std::numbers::pi) / lambda * sum;
+  }
+
+  // 1 - K(lambda) = 2 sum (-1)^(k - 1) exp(-2 k^2 lambda^2)
+  for (int k = 1; k <= kKolmogorovSeriesTerms; ++k) {
+    const double term = std::exp(-2.0 * k * k * lambda * lambda);
+    sum += k % 2 == 1 ? term : -term;
+
+    if (term < std::numeric_limits<double>::epsilon() * sum)
+      break;
+  }
+
+  return std::clamp(2 * sum, 0.0, 1.0);
+}
+
+double KolmogorovExactCdf(std::size_t n, double d) {
+  if (n == 0)
+    throw std::invalid_argument("Sample size must be positive");
+
+  const auto nd = static_cast<double>(n);
+
+  if (d <= 0)
+    return 0;
+
+  if (d >= 1)
+    return 1;
+
+  // Дальний хвост, где P(D_n >= d) < 1e-6: приближение из той же статьи, точность 7 знаков
+  const double s = d * d * nd;
+
+  if (s > kKolmogorovFarTail || (s > kKolmogorovFarTailLarge && n > kKolmogorovLargeSize))
+    return 1 - 2 * std::exp(-(2.000071 + 0.331 / std::sqrt(nd) + 1.409 / nd) * s);
+
+  const auto k = static_cast<std::size_t>(nd * d) + 1;
+  const std::size_t m = 2 * k - 1;
+  const double h = static_cast<double>(k) - nd * d;
+
+  Matrix base(m * m);
+
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t j = 0; j < m; ++j) {
+      base[i * m + j] = i + 1 >= j ? 1 : 0;
+    }
+  }
+
+  for (std::size_t i = 0; i < m; ++i) {
+    base[i * m] -= std::pow(h, static_cast<double>(i + 1));
+    base[(m - 1) * m + i] -= std::pow(h, static_cast<double>(m - i));
+  }
+
+  if (2 * h - 1 > 0)
+    base[(m - 1) * m] += std::pow(2 * h - 1, static_cast<double>(m));
+
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t j = 0; j < m; ++j) {
+      for (std::size_t g = 1; i + 1 >= j && g <= i + 1 - j; ++g) {
+        base[i * m + j] /= static_cast<double>(g);
+      }
+    }
+  }
+
+  Matrix power;
+  int exponent = 0;
+  Power(base, m, n, power, exponent);
+
+  // P(D_n < d) = n! / n^n * (H^n)_kk
+  double result = power[(k - 1) * m + k - 1];
+
+  for (std::size_t i = 1; i <= n; ++i) {
+    result = result * static_cast<double>(i) / nd;
+
+    if (result < 1 / kMatrixScale) {
+      result *= kMatrixScale;
+      exponent -= kMatrixScaleExponent;
+    }
+  }
+
+  return std::clamp(result * std::pow(10.0, exponent), 0.0, 1.0);
+}
+
+GoodnessOfFitResult GoodnessOfFit(const Distribution& dist, std::span<double> sample, std::size_t threads) {
+  const std::size_t n = sample.size();
+  const auto nd = static_cast<double>(n);
+  GoodnessOfFitResult result;
+  result.sample_size = n;
+
+  if (n == 0)
+    return result;
+
+  ParallelSort(sample, threads);
+
+  std::vector<double> cdf(n);
+  const std::size_t blocks = (n + kSampleBatchSize - 1) / kSampleBatchSize;
+
+  ParallelFor(blocks, threads, [&](std::size_t b) {
+    const std::size_t begin = b * kSampleBatchSize;
+    const std::size_t count = std::min(kSampleBatchSize, n - begin);
+    dist.CdfBatch(sample.subspan(begin, count), std::span<double>(cdf).subspan(begin, count));
+  });
+
+  double anderson_darling = 0;
+  double cramer_von_mises = 0;
+
+  for (std::size_t i = 0; i < n; ++i) {
+    const double z = cdf[i];
+    const auto id = static_cast<double>(i);
+
+    result.ks_plus = std::max(result.ks_plus, (id + 1) / nd - z);
+    result.ks_minus = std::max(result.ks_minus, z - id / nd);
+
+    const double deviation = z - (2 * id + 1) / (2 * nd);
+    cramer_von_mises += deviation * deviation;
+
+    const double lower = std::clamp(z, kMinCdf, kMaxCdf);
+    const double upper = std::clamp(cdf[n - 1 - i], kMinCdf, kMaxCdf);
+    anderson_darling += (2 * id + 1) * (std::log(lower) + std::log1p(-upper));
+  }
+
+  result.ks_statistic = std::max(result.ks_plus, result.ks_minus);
+  result.ks_p_value_asymptotic = KolmogorovAsymptoticPValue(std::sqrt(nd) * result.ks_statistic);
+  result.ks_p_value_exact = n <= kKolmogorovExactMaxSize ? 1 - KolmogorovExactCdf(n, result.ks_statistic)
+                                                         : std::numeric_limits<double>::quiet_NaN();
+  result.anderson_darling = -nd - anderson_darling / nd;
+  result.cramer_von_mises = 1 / (12 * nd) + cramer_von_mises;
+
+  return result;
+}
+
+} // namespace ptm
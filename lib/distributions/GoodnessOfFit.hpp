@@ -0,0 +1,40 @@
+#ifndef PTM_GOODNESSOFFIT_HPP_
+#define PTM_GOODNESSOFFIT_HPP_
+
+#include <cstddef>
+#include <span>
+
+#include "Distribution.hpp"
+
+namespace ptm {
+
+// Точный p-value Колмогорова считается для выборок не больше этой: размер матрицы растёт как sqrt(n),
+// а дальше асимптотика и так точна
+const std::size_t kKolmogorovExactMaxSize = 1000;
+
+// Критерии согласия выборки с непрерывным распределением.
+// Для дискретных распределений статистики смещены в сторону принятия гипотезы
+struct GoodnessOfFitResult {
+  std::size_t sample_size = 0;
+  double ks_statistic = 0.0; // D_n = max(D+, D-)
+  double ks_plus = 0.0;      // D+ = max(i / n - F(x_(i)))
+  double ks_minus = 0.0;     // D- = max(F(x_(i)) - (i - 1) / n)
+  double ks_p_value_asymptotic = 0.0;
+  double ks_p_value_exact = 0.0; // NaN при sample_size > kKolmogorovExactMaxSize
+  double anderson_darling = 0.0; // A^2
+  double cramer_von_mises = 0.0; // W^2
+};
+
+// P(sqrt(n) D_n > lambda) в пределе n -> inf (распределение Колмогорова)
+[[nodiscard]] double KolmogorovAsymptoticPValue(double lambda);
+
+// P(D_n < d) точно: алгоритм Marsaglia, Tsang, Wang (2003) через степень матрицы
+[[nodiscard]] double KolmogorovExactCdf(std::size_t n, double d);
+
+// Сортирует sample на threads потоках и за один проход по F(x_(i)) считает KS, Андерсона-Дарлинга
+// и Крамера-фон Мизеса
+GoodnessOfFitResult GoodnessOfFit(const Distribution& dist, std::span<double> sample, std::size_t threads = 0);
+
+} // namespace ptm
+
+#endif // PTM_GOODNESSOFFIT_HPP_
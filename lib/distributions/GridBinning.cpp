@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "GridBinning.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Допуск, с которым сетка считается равномерной (в долях её шага)
+const double kUniformGridTolerance = 1e-9;
+
+} // namespace
+
+GridBinning::GridBinning(std::span<const double> grid) : grid_(grid.begin(), grid.end()) {
+  if (!std::is_sorted(grid_.begin(), grid_.end()))
+    throw std::invalid_argument("Grid must be sorted");
+
+  if (grid_.size() < 2)
+    return;
+
+  const double step = (grid_.back() - grid_.front()) / static_cast<double>(grid_.size() - 1);
+
+  if (!(step > 0))
+    return;
+
+  uniform_ = true;
+
+  for (std::size_t j = 0; j < grid_.size() && uniform_; ++j) {
+    const double expected = grid_.front() + step * static_cast<double>(j);
+    uniform_ = std::abs(grid_[j] - expected) <= kUniformGridTolerance * step;
+  }
+
+  origin_ = grid_.front();
+  inv_step_ = 1 / step;
+}
+
+std::size_t GridBinning::Bin(double value) const {
+  if (!uniform_)
+    return SearchBin(value);
+
+  // Оценка по арифметике может ошибиться на узел из-за округления - уточняем сравнениями с узлами
+  const double position = std::ceil((value - origin_) * inv_step_);
+  const double max_bin = static_cast<double>(grid_.size());
+  auto bin = static_cast<std::size_t>(std::clamp(position, 0.0, max_bin));
+
+  while (bin > 0 && grid_[bin - 1] >= value) {
+    --bin;
+  }
+
+  while (bin < grid_.size() && grid_[bin] < value) {
+    ++bin;
+  }
+
+  return bin;
+}
+
+void GridBinning::Count(std::span<const double> values, std::span<std::uint64_t> counts) const {
+  for (double value : values) {
+    ++counts[Bin(value)];
+  }
+}
+
+std::vector<double> GridBinning::Cdf(std::span<const std::uint64_t> counts, std::uint64_t total) const {
+  std::vector<double> result(grid_.size());
+  std::uint64_t cumulative = 0;
+
+  for (std::size_t j = 0; j < grid_.size(); ++j) {
+    cumulative += counts[j];
+    result[j] = static_cast<double>(cumulative) / static_cast<double>(total);
+  }
+
+  return result;
+}
+
+std::size_t GridBinning::Size() const noexcept {
+  return grid_.size();
+}
+
+bool GridBinning::IsUniform() const noexcept {
+  return uniform_;
+}
+
+std::size_t GridBinning::SearchBin(double value) const {
+  if (grid_.empty())
+    return 0;
+
+  // Khuong, Morin (2017): длина отрезка уменьшается одинаково при любом исходе сравнения,
+  // поэтому выбор половины компилируется в cmov
+  const double* base = grid_.data();
+  std::size_t length = grid_.size();
+
+  while (length > 1) {
+    const std::size_t half = length / 2;
+    base = base[half] < value ? base + half : base;
+    length -= half;
+  }
+
+  return static_cast<std::size_t>(base - grid_.data()) + (*base < value ? 1 : 0);
+}
+
+} // namespace ptm
@@ -0,0 +1,40 @@
+#ifndef PTM_GRIDBINNING_HPP_
+#define PTM_GRIDBINNING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ptm {
+
+// Раскладка значений по ячейкам отсортированной сетки: ячейка значения v - число узлов сетки,
+// меньших v (как у std::lower_bound). Для равномерной сетки номер считается арифметикой,
+// иначе - бинарным поиском без ветвлений
+class GridBinning {
+public:
+  explicit GridBinning(std::span<const double> grid);
+
+  [[nodiscard]] std::size_t Bin(double value) const;
+
+  // counts[Bin(v)] += 1 для каждого v из values; размер counts - Size() + 1
+  void Count(std::span<const double> values, std::span<std::uint64_t> counts) const;
+
+  // Эмпирическая CDF в узлах сетки по счётчикам ячеек: F(grid[j]) = (counts[0] + ... + counts[j]) / total
+  [[nodiscard]] std::vector<double> Cdf(std::span<const std::uint64_t> counts, std::uint64_t total) const;
+
+  [[nodiscard]] std::size_t Size() const noexcept;
+  [[nodiscard]] bool IsUniform() const noexcept;
+
+private:
+  std::vector<double> grid_;
+  bool uniform_ = false;
+  double origin_ = 0;
+  double inv_step_ = 0;
+
+  [[nodiscard]] std::size_t SearchBin(double value) const;
+};
+
+} // namespace ptm
+
+#endif // PTM_GRIDBINNING_HPP_
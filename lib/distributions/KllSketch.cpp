@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "KllSketch.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Уровень ниже верхнего в c раз короче; минимальная ёмкость уровня
+const double kKllCapacityRatio = 2.0 / 3.0;
+const std::size_t kKllMinCapacity = 2;
+
+// NormalizedRankError: 2.296 / k^0.9723
+const double kKllErrorFactor = 2.296;
+const double kKllErrorExponent = 0.9723;
+
+} // namespace
+
+KllSketch::KllSketch(std::size_t k, std::uint64_t seed) : k_(k), coin_(seed) {
+  if (k < kKllMinCapacity)
+    throw std::invalid_argument("KLL parameter k is too small");
+
+  Grow();
+}
+
+void KllSketch::Update(double value) {
+  levels_.front().push_back(value);
+  ++size_;
+  ++count_;
+
+  if (size_ >= max_size_)
+    Compress();
+}
+
+void KllSketch::UpdateBatch(std::span<const double> values) {
+  for (double value : values) {
+    Update(value);
+  }
+}
+
+void KllSketch::Merge(const KllSketch& other) {
+  while (levels_.size() < other.levels_.size()) {
+    Grow();
+  }
+
+  for (std::size_t h = 0; h < other.levels_.size(); ++h) {
+    levels_[h].insert(levels_[h].end(), other.levels_[h].begin(), other.levels_[h].end());
+  }
+
+  size_ += other.size_;
+  count_ += other.count_;
+
+  while (size_ >= max_size_) {
+    Compress();
+  }
+}
+
+std::uint64_t KllSketch::Count() const noexcept {
+  return count_;
+}
+
+std::size_t KllSketch::RetainedItems() const noexcept {
+  return size_;
+}
+
+double KllSketch::Rank(double x) const {
+  if (count_ == 0)
+    return std::numeric_limits<double>::quiet_NaN();
+
+  std::uint64_t weight = 0;
+
+  for (std::size_t h = 0; h < levels_.size(); ++h) {
+    const auto below = std::count_if(levels_[h].begin(), levels_[h].end(), [x](double v) { return v <= x; });
+    weight += static_cast<std::uint64_t>(below) << h;
+  }
+
+  return static_cast<double>(weight) / static_cast<double>(count_);
+}
+
+std::vector<double> KllSketch::Cdf(std::span<const double> points) const {
+  std::vector<double> values;
+  std::vector<std::uint64_t> cumulative;
+  SortedView(values, cumulative);
+
+  std::vector<double> result(points.size());
+
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const auto index = std::upper_bound(values.begin(), values.end(), points[i]) - values.begin();
+    result[i] = index == 0 ? 0 : static_cast<double>(cumulative[index - 1]) / static_cast<double>(count_);
+  }
+
+  return result;
+}
+
+double KllSketch::Quantile(double p) const {
+  if (count_ == 0)
+    return std::numeric_limits<double>::quiet_NaN();
+
+  std::vector<double> values;
+  std::vector<std::uint64_t> cumulative;
+  SortedView(values, cumulative);
+
+  const double target = p * static_cast<double>(count_);
+  const auto it = std::lower_bound(cumulative.begin(), cumulative.end(), target,
+                                   [](std::uint64_t weight, double t) { return static_cast<double>(weight) < t; });
+
+  return values[std::min<std::size_t>(it - cumulative.begin(), values.size() - 1)];
+}
+
+double KllSketch::KolmogorovDistance(const Distribution& dist) const {
+  std::vector<double> values;
+  std::vector<std::uint64_t> cumulative;
+  SortedView(values, cumulative);
+
+  std::vector<double> theoretical(values.size());
+  dist.CdfBatch(values, theoretical);
+
+  const auto n = static_cast<double>(count_);
+  double distance = 0;
+  std::uint64_t before = 0;
+
+  // Ступенчатая эмпирическая CDF: сравниваем F с её значениями слева и справа от каждой ступени
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    distance = std::max(distance, theoretical[i] - static_cast<double>(before) / n);
+    distance = std::max(distance, static_cast<double>(cumulative[i]) / n - theoretical[i]);
+    before = cumulative[i];
+  }
+
+  return distance;
+}
+
+double KllSketch::NormalizedRankError() const {
+  return kKllErrorFactor / std::pow(static_cast<double>(k_), kKllErrorExponent);
+}
+
+std::size_t KllSketch::Capacity(std::size_t level) const {
+  const auto depth = static_cast<double>(levels_.size() - level - 1);
+
+  return std::max(kKllMinCapacity, static_cast<std::size_t>(std::ceil(std::pow(kKllCapacityRatio, depth) * k_)));
+}
+
+void KllSketch::Grow() {
+  levels_.emplace_back();
+  max_size_ = 0;
+
+  for (std::size_t h = 0; h < levels_.size(); ++h) {
+    max_size_ += Capacity(h);
+  }
+}
+
+void KllSketch::Compress() {
+  for (std::size_t h = 0; h < levels_.size(); ++h) {
+    if (levels_[h].size() < Capacity(h))
+      continue;
+
+    if (h + 1 == levels_.size())
+      Grow();
+
+    std::vector<double>& level = levels_[h];
+    std::vector<double>& upper = levels_[h + 1];
+    std::sort(level.begin(), level.end());
+
+    // При нечётной длине одно значение остаётся на уровне
+    const std::size_t kept = level.size() % 2;
+    const std::size_t offset = kept + (coin_() & 1u);
+
+    for (std::size_t i = offset; i < level.size(); i += 2) {
+      upper.push_back(level[i]);
+    }
+
+    size_ -= (level.size() - kept) / 2;
+    level.resize(kept);
+
+    return;
+  }
+}
+
+void KllSketch::SortedView(std::vector<double>& values, std::vector<std::uint64_t>& cumulative) const {
+  std::vector<std::pair<double, std::uint64_t>> items;
+  items.reserve(size_);
+
+  for (std::size_t h = 0; h < levels_.size(); ++h) {
+    for (double value : levels_[h]) {
+      items.emplace_back(value, std::uint64_t{1} << h);
+    }
+  }
+
+  std::sort(items.begin(), items.end());
+
+  values.clear();
+  cumulative.clear();
+  std::uint64_t total = 0;
+
+  for (const auto& [value, weight] : items) {
+    total += weight;
+
+    if (!values.empty() && values.back() == value) {
+      cumulative.back() = total;
+    } else {
+      values.push_back(value);
+      cumulative.push_back(total);
+    }
+  }
+}
+
+} // namespace ptm
@@ -1,4 +1,8 @@
+#include <cmath>
+
 #include "LaplaceDistribution.hpp"
+#include "VectorMath.hpp"
+#include "Ziggurat.hpp"
 
 namespace ptm {
 
@@ -16,10 +20,51 @@ double LaplaceDistribution::Cdf(double x) const {
     return kLaplaceDistributionOne - kLaplaceDistributionMu * std::exp(-(x - mu_) / b_);
 }
 
+double LaplaceDistribution::Quantile(double p) const {
+  CheckProbability(p);
+
+  if (p < kLaplaceDistributionMu)
+    return mu_ + b_ * std::log(2 * p);
+  else
+    return mu_ - b_ * std::log(2 * (1 - p));
+}
+
+std::optional<double> LaplaceDistribution::SymmetryCenter() const {
+  return mu_;
+}
+
+void LaplaceDistribution::PdfBatch(std::span<const double> x, std::span<double> out) const {
+  const double scale = 1 / b_;
+  const double factor = scale / 2;
+
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    out[i] = factor * FastExp(-std::abs(x[i] - mu_) * scale);
+  }
+}
+
+void LaplaceDistribution::CdfBatch(std::span<const double> x, std::span<double> out) const {
+  const double scale = 1 / b_;
+
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    const double half_tail = kLaplaceDistributionMu * FastExp(-std::abs(x[i] - mu_) * scale);
+    out[i] = x[i] < mu_ ? half_tail : kLaplaceDistributionOne - half_tail;
+  }
+}
+
 double LaplaceDistribution::Sample(std::mt19937& rng) const {
-  std::exponential_distribution distribution(1 / b_);
+  return SampleImpl(rng);
+}
 
-  return mu_ + distribution(rng) * (rng() % 2 ? -1 : 1);
+double LaplaceDistribution::Sample(Philox4x32& rng) const {
+  return SampleImpl(rng);
+}
+
+void LaplaceDistribution::SampleBatch(std::mt19937& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
+}
+
+void LaplaceDistribution::SampleBatch(Philox4x32& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
 }
 
 double LaplaceDistribution::TheoreticalMean() const {
@@ -30,4 +75,26 @@ double LaplaceDistribution::TheoreticalVariance() const {
   return 2 * std::pow(b_, 2);
 }
 
+double LaplaceDistribution::GetMu() const {
+  return mu_;
+}
+
+double LaplaceDistribution::GetScale() const {
+  return b_;
+}
+
+template <RandomEngine Engine>
+double LaplaceDistribution::SampleImpl(Engine& rng) const {
+  return mu_ + b_ * StandardLaplace(rng);
+}
+
+template <RandomEngine Engine>
+void LaplaceDistribution::SampleBatchImpl(Engine& rng, std::span<double> out) const {
+  FillStandardLaplace(rng, out);
+
+  for (double& value : out) {
+    value = mu_ + b_ * value;
+  }
+}
+
 } // namespace ptm
@@ -11,20 +11,36 @@ const double kLaplaceDistributionMu = 0.5;
 const double kLaplaceDistributionOne = 1.0;
 
 // Распределение Лапласа Laplace(mu, b)
-class LaplaceDistribution : public Distribution {
+class LaplaceDistribution final : public Distribution {
 public:
   LaplaceDistribution(double mu, double b);
 
   [[nodiscard]] double Pdf(double x) const override;
   [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double p) const override;
+  [[nodiscard]] std::optional<double> SymmetryCenter() const override;
+  void PdfBatch(std::span<const double> x, std::span<double> out) const override;
+  void CdfBatch(std::span<const double> x, std::span<double> out) const override;
   double Sample(std::mt19937& rng) const override;
+  double Sample(Philox4x32& rng) const override;
+  void SampleBatch(std::mt19937& rng, std::span<double> out) const override;
+  void SampleBatch(Philox4x32& rng, std::span<double> out) const override;
 
   [[nodiscard]] double TheoreticalMean() const override;
   [[nodiscard]] double TheoreticalVariance() const override;
 
+  [[nodiscard]] double GetMu() const;
+  [[nodiscard]] double GetScale() const;
+
 private:
   double mu_;
   double b_;
+
+  template <RandomEngine Engine>
+  double SampleImpl(Engine& rng) const;
+
+  template <RandomEngine Engine>
+  void SampleBatchImpl(Engine& rng, std::span<double> out) const;
 };
 
 } // namespace ptm
@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <cmath>
+
+#include "MomentAccumulator.hpp"
+
+namespace ptm {
+
+void MomentAccumulator::Add(double value) {
+  MomentAccumulator single;
+  single.count_ = 1;
+  single.mean_ = value;
+  single.min_ = value;
+  single.max_ = value;
+
+  Merge(single);
+}
+
+void MomentAccumulator::AddBatch(std::span<const double> values) {
+  if (values.empty())
+    return;
+
+  MomentAccumulator block;
+  block.count_ = values.size();
+
+  double sum = 0;
+
+  for (double value : values) {
+    sum += value;
+    block.min_ = std::min(block.min_, value);
+    block.max_ = std::max(block.max_, value);
+  }
+
+  block.mean_ = sum / static_cast<double>(values.size());
+
+  for (double value : values) {
+    const double deviation = value - block.mean_;
+    const double square = deviation * deviation;
+    block.m2_ += square;
+    block.m3_ += square * deviation;
+    block.m4_ += square * square;
+  }
+
+  Merge(block);
+}
+
+void MomentAccumulator::Merge(const MomentAccumulator& other) {
+  if (other.count_ == 0)
+    return;
+
+  if (count_ == 0) {
+    *this = other;
+    return;
+  }
+
+  const auto na = static_cast<double>(count_);
+  const auto nb = static_cast<double>(other.count_);
+  const double n = na + nb;
+  const double delta = other.mean_ - mean_;
+  const double delta_n = delta / n;
+  const double delta_n2 = delta_n * delta_n;
+  const double cross = delta * delta_n * na * nb; // delta^2 na nb / n
+
+  // Pébay (2008), формулы (2.1)-(2.3) для объединения выборок
+  m4_ += other.m4_ + cross * delta_n2 * (na * na - na * nb + nb * nb) +
+         6 * delta_n2 * (na * na * other.m2_ + nb * nb * m2_) + 4 * delta_n * (na * other.m3_ - nb * m3_);
+  m3_ += other.m3_ + cross * delta_n * (na - nb) + 3 * delta_n * (na * other.m2_ - nb * m2_);
+  m2_ += other.m2_ + cross;
+  mean_ += delta_n * nb;
+  count_ += other.count_;
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+}
+
+std::size_t MomentAccumulator::Count() const noexcept {
+  return count_;
+}
+
+double MomentAccumulator::Mean() const noexcept {
+  return mean_;
+}
+
+double MomentAccumulator::Variance() const noexcept {
+  return m2_ / static_cast<double>(count_);
+}
+
+double MomentAccumulator::Skewness() const noexcept {
+  return std::sqrt(static_cast<double>(count_)) * m3_ / std::pow(m2_, 1.5);
+}
+
+double MomentAccumulator::Kurtosis() const noexcept {
+  return static_cast<double>(count_) * m4_ / (m2_ * m2_) - 3;
+}
+
+double MomentAccumulator::Min() const noexcept {
+  return min_;
+}
+
+double MomentAccumulator::Max() const noexcept {
+  return max_;
+}
+
+} // namespace ptm
@@ -0,0 +1,44 @@
+#ifndef PTM_MOMENTACCUMULATOR_HPP_
+#define PTM_MOMENTACCUMULATOR_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <span>
+
+namespace ptm {
+
+// Потоковые центральные моменты до четвёртого, минимум и максимум за один проход и O(1) памяти.
+// Блок значений сначала сводится к своим моментам (плотный цикл по данным в кэше), затем
+// сливается с накопленными по формулам Chan-Pébay; так же сливаются аккумуляторы разных потоков
+class MomentAccumulator {
+public:
+  void Add(double value);
+  void AddBatch(std::span<const double> values);
+  void Merge(const MomentAccumulator& other);
+
+  [[nodiscard]] std::size_t Count() const noexcept;
+  [[nodiscard]] double Mean() const noexcept;
+
+  // Смещённая (делённая на n) дисперсия - как в ExperimentStats
+  [[nodiscard]] double Variance() const noexcept;
+
+  // Коэффициент асимметрии и эксцесс (kurtosis - 3); NaN при нулевой дисперсии
+  [[nodiscard]] double Skewness() const noexcept;
+  [[nodiscard]] double Kurtosis() const noexcept;
+
+  [[nodiscard]] double Min() const noexcept;
+  [[nodiscard]] double Max() const noexcept;
+
+private:
+  std::size_t count_ = 0;
+  double mean_ = 0;
+  double m2_ = 0;
+  double m3_ = 0;
+  double m4_ = 0;
+  double min_ = std::numeric_limits<double>::infinity();
+  double max_ = -std::numeric_limits<double>::infinity();
+};
+
+} // namespace ptm
+
+#endif // PTM_MOMENTACCUMULATOR_HPP_
@@ -1,6 +1,11 @@
+#include <cmath>
+#include <limits>
 #include <numbers>
 
 #include "NormalDistribution.hpp"
+#include "SpecialFunctions.hpp"
+#include "VectorMath.hpp"
+#include "Ziggurat.hpp"
 
 namespace ptm {
 
@@ -8,17 +13,60 @@ NormalDistribution::NormalDistribution(double mean, double stddev) : mean_(mean)
 }
 
 double NormalDistribution::Pdf(double x) const {
-  return std::exp(-std::pow(x - mean_, 2) / 2 / std::pow(stddev_, 2)) / stddev_ / std::sqrt(2 * std::numbers::pi);
+  const double z = (x - mean_) / stddev_;
+
+  return std::exp(-z * z / 2) / stddev_ / std::sqrt(2 * std::numbers::pi);
 }
 
 double NormalDistribution::Cdf(double x) const {
   return kNormalDistributionFactor * (1 + std::erf((x - mean_) / stddev_ / std::numbers::sqrt2));
 }
 
+double NormalDistribution::Quantile(double p) const {
+  CheckProbability(p);
+
+  if (p == 0 || p == 1)
+    return p == 0 ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+
+  return mean_ + stddev_ * StandardNormalQuantile(p);
+}
+
+std::optional<double> NormalDistribution::SymmetryCenter() const {
+  return mean_;
+}
+
+void NormalDistribution::PdfBatch(std::span<const double> x, std::span<double> out) const {
+  const double scale = 1 / stddev_;
+  const double factor = scale / std::sqrt(2 * std::numbers::pi);
+
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    const double z = (x[i] - mean_) * scale;
+    out[i] = factor * FastExp(-z * z / 2);
+  }
+}
+
+void NormalDistribution::CdfBatch(std::span<const double> x, std::span<double> out) const {
+  const double scale = 1 / stddev_;
+
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    out[i] = FastStandardNormalCdf((x[i] - mean_) * scale);
+  }
+}
+
 double NormalDistribution::Sample(std::mt19937& rng) const {
-  std::normal_distribution distribution(mean_, stddev_);
+  return SampleImpl(rng);
+}
+
+double NormalDistribution::Sample(Philox4x32& rng) const {
+  return SampleImpl(rng);
+}
+
+void NormalDistribution::SampleBatch(std::mt19937& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
+}
 
-  return distribution(rng);
+void NormalDistribution::SampleBatch(Philox4x32& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
 }
 
 double NormalDistribution::TheoreticalMean() const {
@@ -37,4 +85,18 @@ double NormalDistribution::GetStddev() const {
   return stddev_;
 }
 
+template <RandomEngine Engine>
+double NormalDistribution::SampleImpl(Engine& rng) const {
+  return mean_ + stddev_ * StandardNormal(rng);
+}
+
+template <RandomEngine Engine>
+void NormalDistribution::SampleBatchImpl(Engine& rng, std::span<double> out) const {
+  FillStandardNormal(rng, out);
+
+  for (double& value : out) {
+    value = mean_ + stddev_ * value;
+  }
+}
+
 } // namespace ptm
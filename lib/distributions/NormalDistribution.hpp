@@ -10,13 +10,20 @@ namespace ptm {
 const double kNormalDistributionFactor = 0.5;
 
 // Нормальное N(mu, sigma^2)
-class NormalDistribution : public Distribution {
+class NormalDistribution final : public Distribution {
 public:
   NormalDistribution(double mean, double stddev);
 
   [[nodiscard]] double Pdf(double x) const override;
   [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double p) const override;
+  [[nodiscard]] std::optional<double> SymmetryCenter() const override;
+  void PdfBatch(std::span<const double> x, std::span<double> out) const override;
+  void CdfBatch(std::span<const double> x, std::span<double> out) const override;
   double Sample(std::mt19937& rng) const override;
+  double Sample(Philox4x32& rng) const override;
+  void SampleBatch(std::mt19937& rng, std::span<double> out) const override;
+  void SampleBatch(Philox4x32& rng, std::span<double> out) const override;
 
   [[nodiscard]] double TheoreticalMean() const override;
   [[nodiscard]] double TheoreticalVariance() const override;
@@ -27,6 +34,12 @@ public:
 private:
   double mean_;
   double stddev_;
+
+  template <RandomEngine Engine>
+  double SampleImpl(Engine& rng) const;
+
+  template <RandomEngine Engine>
+  void SampleBatchImpl(Engine& rng, std::span<double> out) const;
 };
 
 } // namespace ptm
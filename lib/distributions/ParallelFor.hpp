@@ -0,0 +1,100 @@
+#ifndef PTM_PARALLELFOR_HPP_
+#define PTM_PARALLELFOR_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace ptm {
+
+// Меньшие части ParallelSort сортирует одним потоком
+const std::size_t kParallelSortMinPart = std::size_t{1} << 15;
+
+// Вызывает body(i) для каждого i из [0, count) на threads потоках (0 - по числу ядер).
+// Индексы раздаются через атомарный счётчик, поэтому результат не должен зависеть от порядка
+// вызовов; первое исключение из body пробрасывается в вызывающий поток после остановки всех потоков
+template <class Body>
+void ParallelFor(std::size_t count, std::size_t threads, const Body& body) {
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+
+  threads = std::min(threads, count);
+
+  if (threads <= 1) {
+    for (std::size_t i = 0; i < count; ++i) {
+      body(i);
+    }
+
+    return;
+  }
+
+  std::atomic<std::size_t> next = 0;
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  auto worker = [&] {
+    for (std::size_t i = next++; i < count; i = next++) {
+      try {
+        body(i);
+      } catch (...) {
+        std::lock_guard lock(error_mutex);
+
+        if (!error)
+          error = std::current_exception();
+
+        next = count;
+      }
+    }
+  };
+
+  std::vector<std::jthread> pool;
+
+  for (std::size_t t = 1; t < threads; ++t) {
+    pool.emplace_back(worker);
+  }
+
+  worker();
+  pool.clear();
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+// Сортировка по возрастанию на threads потоках: части сортируются независимо,
+// затем сливаются попарно, на каждом уровне слияния - тоже параллельно
+template <class T>
+void ParallelSort(std::span<T> values, std::size_t threads = 0) {
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+
+  const std::size_t parts = std::max<std::size_t>(1, std::min(threads, values.size() / kParallelSortMinPart));
+  std::vector<std::size_t> bounds(parts + 1);
+
+  for (std::size_t i = 0; i <= parts; ++i) {
+    bounds[i] = values.size() * i / parts;
+  }
+
+  ParallelFor(parts, threads, [&](std::size_t i) {
+    std::sort(values.begin() + bounds[i], values.begin() + bounds[i + 1]);
+  });
+
+  for (std::size_t width = 1; width < parts; width *= 2) {
+    ParallelFor((parts + 2 * width - 1) / (2 * width), threads, [&](std::size_t pair) {
+      const std::size_t first = 2 * width * pair;
+      const std::size_t middle = std::min(first + width, parts);
+      const std::size_t last = std::min(first + 2 * width, parts);
+
+      auto begin = values.begin();
+      std::inplace_merge(begin + bounds[first], begin + bounds[middle], begin + bounds[last]);
+    });
+  }
+}
+
+} // namespace ptm
+
+#endif // PTM_PARALLELFOR_HPP_
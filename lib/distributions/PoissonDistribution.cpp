@@ -1,41 +1,94 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
 #include "PoissonDistribution.hpp"
 
 namespace ptm {
 
-PoissonDistribution::PoissonDistribution(double lambda) : lambda_(lambda) {
+PoissonDistribution::PoissonDistribution(double lambda) :
+    lambda_(lambda), cumulative_(std::make_shared<CumulativeTable>()) {
+}
+
+void PoissonDistribution::EnableAliasTable(double tail_mass) {
+  if (tail_mass < 0 || tail_mass >= 1)
+    throw std::invalid_argument("Tail mass must be in [0, 1)");
+
+  alias_table_ = std::make_shared<LazyAliasTable>(tail_mass);
 }
 
 double PoissonDistribution::Pdf(double x) const {
   if (x < 0 || x != std::round(x))
     return 0;
 
-  std::uint32_t k = std::lround(x);
-  std::uint32_t k_fact = 1;
-
-  for (uint32_t i = k; i > 1; --i) {
-    k_fact *= i;
-  }
-
-  return std::pow(lambda_, k) / k_fact * std::exp(-lambda_);
+  return std::exp(LogPmf(x));
 }
 
 double PoissonDistribution::Cdf(double x) const {
   if (x < 0)
     return 0;
 
-  double res = 0;
+  // Таблица заканчивается задолго до этой границы: на ней функция распределения уже равна 1
+  const double max_index = std::numeric_limits<std::uint32_t>::max();
+  const auto k = static_cast<std::size_t>(std::min(std::floor(x), max_index));
 
-  for (int i = 0; i <= x; ++i) {
-    res += Pdf(i);
+  {
+    std::shared_lock lock(cumulative_->mutex);
+
+    if (k < cumulative_->cdf.size())
+      return cumulative_->cdf[k];
+
+    if (cumulative_->saturated)
+      return 1;
   }
 
-  return res;
+  std::unique_lock lock(cumulative_->mutex);
+  GrowCumulativeTable(k);
+
+  return k < cumulative_->cdf.size() ? cumulative_->cdf[k] : 1;
+}
+
+double PoissonDistribution::Quantile(double p) const {
+  CheckProbability(p);
+
+  if (p == 1)
+    return lambda_ == 0 ? 0 : std::numeric_limits<double>::infinity();
+
+  std::size_t size = 0;
+
+  while (true) {
+    {
+      std::shared_lock lock(cumulative_->mutex);
+      const std::vector<double>& cdf = cumulative_->cdf;
+
+      if (!cdf.empty() && (cdf.back() >= p || cumulative_->saturated))
+        return static_cast<double>(std::lower_bound(cdf.begin(), cdf.end(), p) - cdf.begin());
+
+      size = cdf.size();
+    }
+
+    // Таблица дописывается с удвоением до первой точки, где F(k) >= p
+    std::unique_lock lock(cumulative_->mutex);
+    GrowCumulativeTable(std::max<std::size_t>(2 * size, static_cast<std::size_t>(lambda_) + 1));
+  }
 }
 
 double PoissonDistribution::Sample(std::mt19937& rng) const {
-  std::poisson_distribution distribution(lambda_);
+  return SampleImpl(rng);
+}
 
-  return distribution(rng);
+double PoissonDistribution::Sample(Philox4x32& rng) const {
+  return SampleImpl(rng);
+}
+
+void PoissonDistribution::SampleBatch(std::mt19937& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
+}
+
+void PoissonDistribution::SampleBatch(Philox4x32& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
 }
 
 double PoissonDistribution::TheoreticalMean() const {
@@ -46,4 +99,74 @@ double PoissonDistribution::TheoreticalVariance() const {
   return lambda_;
 }
 
+double PoissonDistribution::GetLambda() const {
+  return lambda_;
+}
+
+double PoissonDistribution::LogPmf(double k) const {
+  if (lambda_ == 0)
+    return k == 0 ? 0 : -std::numeric_limits<double>::infinity();
+
+  return k * std::log(lambda_) - lambda_ - std::lgamma(k + 1);
+}
+
+void PoissonDistribution::GrowCumulativeTable(std::size_t k) const {
+  std::vector<double>& cdf = cumulative_->cdf;
+
+  while (cdf.size() <= k && !cumulative_->saturated) {
+    const std::size_t i = cdf.size();
+    const auto id = static_cast<double>(i);
+    double pmf = cumulative_->last_pmf * lambda_ / id;
+
+    // Рекуррентность p(i) = p(i - 1) * lambda / i копит ошибку округления и не выходит из нуля,
+    // если e^-lambda не представимо, поэтому время от времени и в левом хвосте считаем напрямую
+    if (i % kPoissonReseedPeriod == 0 || cumulative_->last_pmf == 0)
+      pmf = std::exp(LogPmf(id));
+
+    const double previous = cdf.empty() ? 0 : cdf.back();
+    const double current = std::min(previous + pmf, 1.0);
+
+    if (id > lambda_ && current == previous)
+      cumulative_->saturated = true;
+    else
+      cdf.push_back(current);
+
+    cumulative_->last_pmf = pmf;
+  }
+}
+
+const AliasTable& PoissonDistribution::GetAliasTable() const {
+  return alias_table_->Get([this](double tail_mass) {
+    return AliasTable::FromPmf([this](std::int64_t k) { return std::exp(LogPmf(static_cast<double>(k))); },
+                               static_cast<std::int64_t>(lambda_),
+                               0,
+                               std::numeric_limits<std::int64_t>::max(),
+                               tail_mass);
+  });
+}
+
+template <RandomEngine Engine>
+double PoissonDistribution::SampleImpl(Engine& rng) const {
+  if (alias_table_)
+    return GetAliasTable().Sample(rng);
+
+  std::poisson_distribution distribution(lambda_);
+
+  return distribution(rng);
+}
+
+template <RandomEngine Engine>
+void PoissonDistribution::SampleBatchImpl(Engine& rng, std::span<double> out) const {
+  if (alias_table_) {
+    GetAliasTable().Fill(rng, out);
+    return;
+  }
+
+  std::poisson_distribution distribution(lambda_);
+
+  for (double& value : out) {
+    value = distribution(rng);
+  }
+}
+
 } // namespace ptm
@@ -1,26 +1,65 @@
 #ifndef PTM_POISSONDISTRIBUTION_HPP_
 #define PTM_POISSONDISTRIBUTION_HPP_
 
+#include <memory>
 #include <random>
+#include <shared_mutex>
+#include <vector>
 
+#include "AliasTable.hpp"
 #include "Distribution.hpp"
 
 namespace ptm {
 
+// Через сколько шагов рекуррентная вероятность пересчитывается заново через lgamma
+const std::size_t kPoissonReseedPeriod = 64;
+
 // Пуассоновское Poisson(lambda)
-class PoissonDistribution : public Distribution {
+class PoissonDistribution final : public Distribution {
 public:
   explicit PoissonDistribution(double lambda);
 
   [[nodiscard]] double Pdf(double x) const override;
   [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double p) const override;
   double Sample(std::mt19937& rng) const override;
+  double Sample(Philox4x32& rng) const override;
+  void SampleBatch(std::mt19937& rng, std::span<double> out) const override;
+  void SampleBatch(Philox4x32& rng, std::span<double> out) const override;
 
   [[nodiscard]] double TheoreticalMean() const override;
   [[nodiscard]] double TheoreticalVariance() const override;
 
+  [[nodiscard]] double GetLambda() const;
+
+  // Включает выборку через alias-таблицу, которая строится при первой генерации.
+  // Хвосты массой tail_mass отбрасываются
+  void EnableAliasTable(double tail_mass = kAliasTableTailMass);
+
 private:
+  // Значения функции распределения в 0, 1, 2, ..., дописываются по мере запросов.
+  // saturated - дальше функция распределения неотличима от 1
+  struct CumulativeTable {
+    std::shared_mutex mutex;
+    std::vector<double> cdf;
+    double last_pmf = 0;
+    bool saturated = false;
+  };
+
   double lambda_;
+  std::shared_ptr<LazyAliasTable> alias_table_;
+  std::shared_ptr<CumulativeTable> cumulative_;
+
+  // Логарифм вероятности целого k >= 0
+  [[nodiscard]] double LogPmf(double k) const;
+  void GrowCumulativeTable(std::size_t k) const;
+  [[nodiscard]] const AliasTable& GetAliasTable() const;
+
+  template <RandomEngine Engine>
+  double SampleImpl(Engine& rng) const;
+
+  template <RandomEngine Engine>
+  void SampleBatchImpl(Engine& rng, std::span<double> out) const;
 };
 
 } // namespace ptm
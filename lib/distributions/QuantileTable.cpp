@@ -0,0 +1,99 @@
+#include <cmath>
+#include <stdexcept>
+
+#include "QuantileTable.hpp"
+#include "RandomBits.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Ограничение Fritsch-Carlson: при alpha^2 + beta^2 <= 9 сплайн на отрезке монотонен
+const double kMonotoneSlopeBound = 9;
+const std::size_t kQuantileTableMinSize = 4;
+
+} // namespace
+
+QuantileTable::QuantileTable(std::shared_ptr<const Distribution> dist, std::size_t cells) :
+    dist_(std::move(dist)), cells_(static_cast<double>(cells)) {
+  if (cells < kQuantileTableMinSize)
+    throw std::invalid_argument("Quantile table needs at least 4 cells");
+
+  const std::size_t nodes = cells - 1;
+  values_.resize(nodes);
+  slopes_.resize(nodes);
+
+  for (std::size_t i = 0; i < nodes; ++i) {
+    values_[i] = dist_->Quantile(static_cast<double>(i + 1) / cells_);
+  }
+
+  std::vector<double> secants(nodes - 1);
+
+  for (std::size_t i = 0; i + 1 < nodes; ++i) {
+    secants[i] = values_[i + 1] - values_[i];
+  }
+
+  slopes_.front() = secants.front();
+  slopes_.back() = secants.back();
+
+  for (std::size_t i = 1; i + 1 < nodes; ++i) {
+    slopes_[i] = secants[i - 1] * secants[i] <= 0 ? 0 : (secants[i - 1] + secants[i]) / 2;
+  }
+
+  for (std::size_t i = 0; i + 1 < nodes; ++i) {
+    if (secants[i] == 0) {
+      slopes_[i] = 0;
+      slopes_[i + 1] = 0;
+      continue;
+    }
+
+    const double alpha = slopes_[i] / secants[i];
+    const double beta = slopes_[i + 1] / secants[i];
+    const double norm = alpha * alpha + beta * beta;
+
+    if (norm > kMonotoneSlopeBound) {
+      const double tau = 3 / std::sqrt(norm);
+      slopes_[i] = tau * alpha * secants[i];
+      slopes_[i + 1] = tau * beta * secants[i];
+    }
+  }
+}
+
+double QuantileTable::Evaluate(double p) const {
+  const double x = p * cells_;
+
+  if (!(x >= 1 && x < cells_ - 1))
+    return dist_->Quantile(p);
+
+  const auto cell = static_cast<std::size_t>(x);
+  const double t = x - static_cast<double>(cell);
+  const std::size_t i = cell - 1;
+
+  // Базисные функции Эрмита
+  const double t2 = t * t;
+  const double t3 = t2 * t;
+  const double h00 = 2 * t3 - 3 * t2 + 1;
+  const double h10 = t3 - 2 * t2 + t;
+  const double h01 = 3 * t2 - 2 * t3;
+  const double h11 = t3 - t2;
+
+  return h00 * values_[i] + h10 * slopes_[i] + h01 * values_[i + 1] + h11 * slopes_[i + 1];
+}
+
+void QuantileTable::EvaluateBatch(std::span<const double> p, std::span<double> out) const {
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    out[i] = Evaluate(p[i]);
+  }
+}
+
+template <RandomEngine Engine>
+void QuantileTable::Fill(Engine& rng, std::span<double> out) const {
+  for (double& value : out) {
+    value = Evaluate(BitsToOpenInterval(NextBits64(rng)));
+  }
+}
+
+template void QuantileTable::Fill(std::mt19937& rng, std::span<double> out) const;
+template void QuantileTable::Fill(Philox4x32& rng, std::span<double> out) const;
+
+} // namespace ptm
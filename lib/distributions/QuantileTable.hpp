@@ -0,0 +1,41 @@
+#ifndef PTM_QUANTILETABLE_HPP_
+#define PTM_QUANTILETABLE_HPP_
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Distribution.hpp"
+
+namespace ptm {
+
+// Число ячеек таблицы по умолчанию
+const std::size_t kQuantileTableSize = 4096;
+
+// Приближённое обращение функции распределения непрерывного распределения за O(1).
+// Q(p) считается в узлах p = i / cells и интерполируется монотонным кубическим сплайном Эрмита
+// (Fritsch, Carlson, 1980). В двух крайних ячейках, где Q(p) может уходить в бесконечность,
+// вызывается точный Quantile
+class QuantileTable {
+public:
+  explicit QuantileTable(std::shared_ptr<const Distribution> dist, std::size_t cells = kQuantileTableSize);
+
+  [[nodiscard]] double Evaluate(double p) const;
+  void EvaluateBatch(std::span<const double> p, std::span<double> out) const;
+
+  // Выборка методом обратной функции: out[i] = Evaluate(u), u равномерно на (0, 1)
+  template <RandomEngine Engine>
+  void Fill(Engine& rng, std::span<double> out) const;
+
+private:
+  std::shared_ptr<const Distribution> dist_;
+  double cells_;
+
+  // Q и наклон сплайна (в единицах на ячейку) в узлах i = 1..cells-1
+  std::vector<double> values_;
+  std::vector<double> slopes_;
+};
+
+} // namespace ptm
+
+#endif // PTM_QUANTILETABLE_HPP_
@@ -0,0 +1,39 @@
+#ifndef PTM_RANDOMBITS_HPP_
+#define PTM_RANDOMBITS_HPP_
+
+#include <cstdint>
+
+#include "random/RandomEngine.hpp"
+
+namespace ptm {
+
+const double kUnitInterval53 = 1.0 / 9007199254740992.0; // 2^-53
+
+// 64 случайных бита из двух последовательных слов 32-битного генератора
+template <RandomEngine Engine>
+std::uint64_t NextBits64(Engine& rng) {
+  const std::uint64_t high = rng();
+  const std::uint64_t low = rng();
+
+  return (high << 32) | low;
+}
+
+// Старшие 53 бита слова как равномерное число на [0, 1).
+// Младшие 11 бит остаются свободными: ими пользуются ziggurat-ядра для номера слоя и знака
+inline double BitsToUnit(std::uint64_t bits) {
+  return static_cast<double>(bits >> 11) * kUnitInterval53;
+}
+
+// Середина ячейки сетки с шагом 2^-53: равномерное число на (0, 1), для обращения функции распределения
+inline double BitsToOpenInterval(std::uint64_t bits) {
+  return (static_cast<double>(bits >> 11) + 0.5) * kUnitInterval53;
+}
+
+// Равномерное число на (0, 1] - безопасно для логарифма
+inline double BitsToOpenUnit(std::uint64_t bits) {
+  return 1.0 - BitsToUnit(bits);
+}
+
+} // namespace ptm
+
+#endif // PTM_RANDOMBITS_HPP_
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "AnyDistribution.hpp"
+#include "MomentAccumulator.hpp"
+#include "ParallelFor.hpp"
+#include "ReplicatedExperiment.hpp"
+#include "SpecialFunctions.hpp"
+#include "random/Philox4x32.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Квантиль уровня p отсортированного массива с линейной интерполяцией (тип 7 по Hyndman-Fan)
+double SortedQuantile(const std::vector<double>& sorted, double p) {
+  const double position = p * static_cast<double>(sorted.size() - 1);
+  const auto index = static_cast<std::size_t>(position);
+
+  if (index + 1 >= sorted.size())
+    return sorted.back();
+
+  return sorted[index] + (position - static_cast<double>(index)) * (sorted[index + 1] - sorted[index]);
+}
+
+void CheckConfidenceLevel(double confidence_level) {
+  if (!(confidence_level > 0 && confidence_level < 1))
+    throw std::invalid_argument("Confidence level must lie in (0, 1)");
+}
+
+void Resize(ReplicaStats& stats, std::size_t replications) {
+  for (std::vector<double>* column : {&stats.empirical_mean,
+                                      &stats.empirical_variance,
+                                      &stats.mean_error,
+                                      &stats.variance_error,
+                                      &stats.skewness,
+                                      &stats.kurtosis,
+                                      &stats.min,
+                                      &stats.max}) {
+    column->resize(replications);
+  }
+}
+
+template <class D>
+void RunReplicas(const D& dist, std::size_t sample_size, std::uint64_t seed, std::size_t threads, ReplicaStats& out) {
+  const std::size_t replications = out.empirical_mean.size();
+  const std::size_t groups = (replications + kReplicaGroupSize - 1) / kReplicaGroupSize;
+  const double theoretical_mean = dist.TheoreticalMean();
+  const double theoretical_variance = dist.TheoreticalVariance();
+
+  ParallelFor(groups, threads, [&](std::size_t g) {
+    std::vector<double> buffer(std::min(kSampleBatchSize, sample_size));
+    const std::size_t end = std::min((g + 1) * kReplicaGroupSize, replications);
+
+    for (std::size_t r = g * kReplicaGroupSize; r < end; ++r) {
+      Philox4x32 rng(seed, r);
+      MomentAccumulator moments;
+
+      for (std::size_t offset = 0; offset < sample_size; offset += kSampleBatchSize) {
+        std::span<double> chunk(buffer.data(), std::min(kSampleBatchSize, sample_size - offset));
+        dist.SampleBatch(rng, chunk);
+        moments.AddBatch(chunk);
+      }
+
+      out.empirical_mean[r] = moments.Mean();
+      out.empirical_variance[r] = moments.Variance();
+      out.mean_error[r] = moments.Mean() - theoretical_mean;
+      out.variance_error[r] = moments.Variance() - theoretical_variance;
+      out.skewness[r] = moments.Skewness();
+      out.kurtosis[r] = moments.Kurtosis();
+      out.min[r] = moments.Min();
+      out.max[r] = moments.Max();
+    }
+  });
+}
+
+} // namespace
+
+ReplicaSummary SummarizeReplicas(std::span<const double> values, double confidence_level) {
+  if (values.size() < 2)
+    throw std::invalid_argument("Replica summary needs at least two values");
+
+  CheckConfidenceLevel(confidence_level);
+
+  if (std::any_of(values.begin(), values.end(), [](double v) { return std::isnan(v); })) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    return {nan, nan, nan, nan, nan, nan, nan, nan};
+  }
+
+  ReplicaSummary summary;
+  const auto count = static_cast<double>(values.size());
+  double sum = 0;
+
+  for (double v : values) {
+    sum += v;
+  }
+
+  summary.mean = sum / count;
+  double squares = 0;
+
+  for (double v : values) {
+    squares += (v - summary.mean) * (v - summary.mean);
+  }
+
+  summary.standard_deviation = std::sqrt(squares / (count - 1));
+  summary.standard_error = summary.standard_deviation / std::sqrt(count);
+
+  const double z = StandardNormalQuantile((1 + confidence_level) / 2);
+  summary.ci_lower = summary.mean - z * summary.standard_error;
+  summary.ci_upper = summary.mean + z * summary.standard_error;
+
+  std::vector<double> sorted(values.begin(), values.end());
+  std::sort(sorted.begin(), sorted.end());
+  summary.quantile_lower = SortedQuantile(sorted, (1 - confidence_level) / 2);
+  summary.median = SortedQuantile(sorted, 0.5);
+  summary.quantile_upper = SortedQuantile(sorted, (1 + confidence_level) / 2);
+
+  return summary;
+}
+
+ReplicatedExperiment::ReplicatedExperiment(std::shared_ptr<Distribution> dist,
+                                           std::size_t sample_size,
+                                           std::size_t replications) :
+    dist_(std::move(dist)), sample_size_(sample_size), replications_(replications) {
+  if (replications < 2)
+    throw std::invalid_argument("Replicated experiment needs at least two replications");
+}
+
+ReplicatedStats ReplicatedExperiment::Run(std::uint64_t seed, std::size_t threads, double confidence_level) const {
+  CheckConfidenceLevel(confidence_level);
+
+  ReplicatedStats result;
+  result.replications = replications_;
+  result.confidence_level = confidence_level;
+  Resize(result.replicas, replications_);
+
+  VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    RunReplicas(*dist, sample_size_, seed, threads, result.replicas);
+  });
+
+  const ReplicaStats& replicas = result.replicas;
+  result.empirical_mean = SummarizeReplicas(replicas.empirical_mean, confidence_level);
+  result.empirical_variance = SummarizeReplicas(replicas.empirical_variance, confidence_level);
+  result.mean_error = SummarizeReplicas(replicas.mean_error, confidence_level);
+  result.variance_error = SummarizeReplicas(replicas.variance_error, confidence_level);
+  result.skewness = SummarizeReplicas(replicas.skewness, confidence_level);
+  result.kurtosis = SummarizeReplicas(replicas.kurtosis, confidence_level);
+  result.min = SummarizeReplicas(replicas.min, confidence_level);
+  result.max = SummarizeReplicas(replicas.max, confidence_level);
+
+  return result;
+}
+
+} // namespace ptm
@@ -0,0 +1,84 @@
+#ifndef PTM_REPLICATEDEXPERIMENT_HPP_
+#define PTM_REPLICATEDEXPERIMENT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Distribution.hpp"
+#include "SpecialFunctions.hpp"
+
+namespace ptm {
+
+// Реплик в одной задаче пула: буфер сэмплов выделяется один раз на группу, а не на реплику
+const std::size_t kReplicaGroupSize = 64;
+
+// Статистики всех реплик в виде структуры массивов: i-й элемент каждого массива - i-я реплика
+struct ReplicaStats {
+  std::vector<double> empirical_mean;
+  std::vector<double> empirical_variance;
+  std::vector<double> mean_error;
+  std::vector<double> variance_error;
+  std::vector<double> skewness;
+  std::vector<double> kurtosis;
+  std::vector<double> min;
+  std::vector<double> max;
+};
+
+// Распределение одной статистики по репликам
+struct ReplicaSummary {
+  double mean = 0.0;
+  double standard_deviation = 0.0;
+  double standard_error = 0.0; // standard_deviation / sqrt(R)
+
+  // Нормальный доверительный интервал для ожидания статистики: mean -+ z * standard_error
+  double ci_lower = 0.0;
+  double ci_upper = 0.0;
+
+  // Эмпирические квантили уровней (1 - level) / 2, 1/2, (1 + level) / 2: интервал, в который
+  // попадает статистика отдельной реплики
+  double quantile_lower = 0.0;
+  double median = 0.0;
+  double quantile_upper = 0.0;
+};
+
+struct ReplicatedStats {
+  ReplicaStats replicas;
+  std::size_t replications = 0;
+  double confidence_level = kDefaultConfidenceLevel;
+
+  ReplicaSummary empirical_mean;
+  ReplicaSummary empirical_variance;
+  ReplicaSummary mean_error;
+  ReplicaSummary variance_error;
+  ReplicaSummary skewness;
+  ReplicaSummary kurtosis;
+  ReplicaSummary min;
+  ReplicaSummary max;
+};
+
+// Сводка по значениям статистики в репликах; NaN-значения (например, skewness при нулевой дисперсии)
+// дают NaN во всех полях
+[[nodiscard]] ReplicaSummary SummarizeReplicas(std::span<const double> values, double confidence_level);
+
+// R независимых повторов эксперимента по sample_size сэмплов. Реплика r генерируется
+// Philox4x32(seed, r), поэтому результат не зависит от числа потоков
+class ReplicatedExperiment {
+public:
+  ReplicatedExperiment(std::shared_ptr<Distribution> dist, std::size_t sample_size, std::size_t replications);
+
+  [[nodiscard]] ReplicatedStats Run(std::uint64_t seed,
+                                    std::size_t threads = 0,
+                                    double confidence_level = kDefaultConfidenceLevel) const;
+
+private:
+  std::shared_ptr<Distribution> dist_;
+  std::size_t sample_size_;
+  std::size_t replications_;
+};
+
+} // namespace ptm
+
+#endif // PTM_REPLICATEDEXPERIMENT_HPP_
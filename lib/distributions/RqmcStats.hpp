@@ -0,0 +1,21 @@
+#ifndef PTM_RQMCSTATS_HPP_
+#define PTM_RQMCSTATS_HPP_
+
+#include <cstddef>
+
+#include "ExperimentStats.hpp"
+
+namespace ptm {
+
+// Итог рандомизированного квази-Монте-Карло: оценки, усреднённые по независимым скремблированиям,
+// и их стандартные ошибки по разбросу между повторами
+struct RqmcStats {
+  ExperimentStats stats;
+  double mean_standard_error = 0.0;
+  double variance_standard_error = 0.0;
+  std::size_t replications = 0;
+};
+
+} // namespace ptm
+
+#endif // PTM_RQMCSTATS_HPP_
@@ -0,0 +1,46 @@
+#ifndef PTM_SEQUENTIALSTATS_HPP_
+#define PTM_SEQUENTIALSTATS_HPP_
+
+#include <cstddef>
+
+#include "Distribution.hpp"
+#include "ExperimentStats.hpp"
+#include "SpecialFunctions.hpp"
+
+namespace ptm {
+
+const double kSequentialGrowthFactor = 2.0;
+const std::size_t kSequentialMaxSamples = std::size_t{1} << 28;
+
+// Критерий остановки последовательного эксперимента. Цель достигнута, если полуширина
+// доверительного интервала для матожидания не больше absolute_precision или relative_precision * |mean|;
+// нулевая точность не используется, хотя бы одна должна быть положительной
+struct SequentialOptions {
+  double absolute_precision = 0.0;
+  double relative_precision = 0.0;
+  double confidence_level = kDefaultConfidenceLevel;
+  std::size_t initial_batch = kSampleBatchSize;
+  double growth_factor = kSequentialGrowthFactor; // каждая следующая партия больше предыдущей в столько раз
+  std::size_t max_samples = kSequentialMaxSamples;
+};
+
+enum class SequentialStatus {
+  kConverged,
+  kBudgetExhausted,
+
+  // Бесконечная или неопределённая теоретическая дисперсия (Коши): интервал по ЦПТ не сужается,
+  // эксперимент останавливается после первой партии
+  kNonConvergent,
+};
+
+struct SequentialStats {
+  ExperimentStats stats;
+  SequentialStatus status = SequentialStatus::kConverged;
+  std::size_t samples_used = 0;
+  std::size_t batches = 0;
+  double half_width = 0.0;
+};
+
+} // namespace ptm
+
+#endif // PTM_SEQUENTIALSTATS_HPP_
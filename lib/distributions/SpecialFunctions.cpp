@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+#include "SpecialFunctions.hpp"
+#include "VectorMath.hpp"
+
+namespace ptm {
+
+namespace {
+
+const double kLentzTiny = 1e-300;
+
+// Начиная с этого z поправка Стирлинга считается рядом
+const double kStirlingSeriesBorder = 15;
+
+// Коэффициенты ряда 1/(12z) - 1/(360z^3) + 1/(1260z^5) - 1/(1680z^7) + 1/(1188z^9)
+const std::array<double, 5> kStirlingSeries = {
+    1.0 / 12, -1.0 / 360, 1.0 / 1260, -1.0 / 1680, 1.0 / 1188,
+};
+
+// При |k - m| < kDevianceSeriesBorder * (k + m) отклонение считается рядом по (k - m) / (k + m)
+const double kDevianceSeriesBorder = 0.1;
+const int kDevianceSeriesMaxTerms = 1000;
+
+// AS 241 (PPND16): центральная область |p - 0.5| <= 0.425 и два участка хвоста, r = sqrt(-ln(min(p, 1 - p))).
+// Коэффициенты - старшая степень первой
+const double kNormalQuantileCentralBorder = 0.425;
+const double kNormalQuantileCentralShift = 0.180625;
+const double kNormalQuantileTailBorder = 5;
+const double kNormalQuantileNearTailShift = 1.6;
+
+const std::array<double, 8> kNormalQuantileCentralNumerator = {
+    2.5090809287301226727e+3, 3.3430575583588128105e+4, 6.7265770927008700853e+4, 4.5921953931549871457e+4,
+    1.3731693765509461125e+4, 1.9715909503065514427e+3, 1.3314166789178437745e+2, 3.3871328727963666080e+0,
+};
+const std::array<double, 8> kNormalQuantileCentralDenominator = {
+    5.2264952788528545610e+3, 2.8729085735721942674e+4, 3.9307895800092710610e+4, 2.1213794301586595867e+4,
+    5.3941960214247511077e+3, 6.8718700749205790830e+2, 4.2313330701600911252e+1, 1.0,
+};
+const std::array<double, 8> kNormalQuantileNearTailNumerator = {
+    7.74545014278341407640e-4, 2.27238449892691845833e-2, 2.41780725177450611770e-1, 1.27045825245236838258e+0,
+    3.64784832476320460504e+0, 5.76949722146069140550e+0, 4.63033784615654529590e+0, 1.42343711074968357734e+0,
+};
+const std::array<double, 8> kNormalQuantileNearTailDenominator = {
+    1.05075007164441684324e-9, 5.47593808499534494600e-4, 1.51986665636164571966e-2, 1.48103976427480074590e-1,
+    6.89767334985100004550e-1, 1.67638483018380384940e+0, 2.05319162663775882187e+0, 1.0,
+};
+const std::array<double, 8> kNormalQuantileFarTailNumerator = {
+    2.01033439929228813265e-7, 2.71155556874348757815e-5, 1.24266094738807843860e-3, 2.65321895265761230930e-2,
+    2.96560571828504891230e-1, 1.78482653991729133580e+0, 5.46378491116411436990e+0, 6.65790464350110377720e+0,
+};
+const std::array<double, 8> kNormalQuantileFarTailDenominator = {
+    2.04426310338993978564e-15, 1.42151175831644588870e-7, 1.84631831751005468180e-5, 7.86869131145613259100e-4,
+    1.48753612908506148525e-2, 1.36929880922735805310e-1, 5.99832206555887937690e-1, 1.0,
+};
+
+// Цепная дробь для I_x(a, b) без множителя x^a (1 - x)^b / (a B(a, b)).
+// Около точки перехода x ~ a / (a + b) дроби нужно O(sqrt(max(a, b))) шагов, поэтому предел растёт с параметрами
+double IncompleteBetaFraction(double a, double b, double x) {
+  const double extra_iterations = kContinuedFractionIterationsPerRoot * std::sqrt(std::max(a, b));
+  const int max_iterations = kContinuedFractionMaxIterations + static_cast<int>(extra_iterations);
+
+  double c = 1;
+  double d = 1 - (a + b) * x / (a + 1);
+
+  if (std::abs(d) < kLentzTiny)
+    d = kLentzTiny;
+
+  d = 1 / d;
+  double result = d;
+
+  for (int m = 1; m <= max_iterations; ++m) {
+    const auto md = static_cast<double>(m);
+
+    // Чётный шаг
+    double numerator = md * (b - md) * x / ((a + 2 * md - 1) * (a + 2 * md));
+    d = 1 + numerator * d;
+    c = 1 + numerator / c;
+
+    if (std::abs(d) < kLentzTiny)
+      d = kLentzTiny;
+
+    if (std::abs(c) < kLentzTiny)
+      c = kLentzTiny;
+
+    d = 1 / d;
+    result *= d * c;
+
+    // Нечётный шаг
+    numerator = -(a + md) * (a + b + md) * x / ((a + 2 * md) * (a + 2 * md + 1));
+    d = 1 + numerator * d;
+    c = 1 + numerator / c;
+
+    if (std::abs(d) < kLentzTiny)
+      d = kLentzTiny;
+
+    if (std::abs(c) < kLentzTiny)
+      c = kLentzTiny;
+
+    d = 1 / d;
+    const double delta = d * c;
+    result *= delta;
+
+    if (std::abs(delta - 1) < kContinuedFractionEpsilon)
+      return result;
+  }
+
+  throw std::runtime_error("Incomplete beta continued fraction did not converge");
+}
+
+} // namespace
+
+double StirlingError(double z) {
+  if (z < kStirlingSeriesBorder)
+    return std::lgamma(z + 1) - (z + 0.5) * std::log(z) + z - std::log(2 * std::numbers::pi) / 2;
+
+  const double inv_square = 1 / (z * z);
+  double result = 0;
+
+  for (auto it = kStirlingSeries.rbegin(); it != kStirlingSeries.rend(); ++it) {
+    result = result * inv_square + *it;
+  }
+
+  return result / z;
+}
+
+double Deviance(double k, double m) {
+  if (k == 0)
+    return m;
+
+  if (std::abs(k - m) >= kDevianceSeriesBorder * (k + m))
+    return k * std::log(k / m) + m - k;
+
+  const double v = (k - m) / (k + m);
+  double result = (k - m) * v;
+  double term = 2 * k * v;
+
+  for (int j = 1; j < kDevianceSeriesMaxTerms; ++j) {
+    term *= v * v;
+    const double next = result + term / (2 * j + 1);
+
+    if (next == result)
+      break;
+
+    result = next;
+  }
+
+  return result;
+}
+
+double RegularizedIncompleteBeta(double a, double b, double x) {
+  if (a <= 0 || b <= 0)
+    throw std::invalid_argument("Beta parameters must be positive");
+
+  if (x <= 0)
+    return 0;
+
+  if (x >= 1)
+    return 1;
+
+  // ln(x^a (1 - x)^b / B(a, b)) через отклонения от моды: разность lgamma больших чисел не нужна
+  const double s = a + b;
+  const double log_front = std::log(a * b / (2 * std::numbers::pi * s)) / 2 + StirlingError(s) - StirlingError(a) -
+                           StirlingError(b) - Deviance(a, s * x) - Deviance(b, s * (1 - x));
+
+  if (x < (a + 1) / (a + b + 2))
+    return std::exp(log_front) * IncompleteBetaFraction(a, b, x) / a;
+
+  return 1 - std::exp(log_front) * IncompleteBetaFraction(b, a, 1 - x) / b;
+}
+
+double StandardNormalQuantile(double p) {
+  const double q = p - 0.5;
+
+  if (std::abs(q) <= kNormalQuantileCentralBorder) {
+    const double r = kNormalQuantileCentralShift - q * q;
+
+    return q * Horner(r, kNormalQuantileCentralNumerator) / Horner(r, kNormalQuantileCentralDenominator);
+  }
+
+  double r = std::sqrt(-std::log(q < 0 ? p : 1 - p));
+  double result = 0;
+
+  if (r <= kNormalQuantileTailBorder) {
+    r -= kNormalQuantileNearTailShift;
+    result = Horner(r, kNormalQuantileNearTailNumerator) / Horner(r, kNormalQuantileNearTailDenominator);
+  } else {
+    r -= kNormalQuantileTailBorder;
+    result = Horner(r, kNormalQuantileFarTailNumerator) / Horner(r, kNormalQuantileFarTailDenominator);
+  }
+
+  return q < 0 ? -result : result;
+}
+
+} // namespace ptm
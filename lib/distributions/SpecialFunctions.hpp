@@ -0,0 +1,31 @@
+#ifndef PTM_SPECIALFUNCTIONS_HPP_
+#define PTM_SPECIALFUNCTIONS_HPP_
+
+namespace ptm {
+
+// Точность и предельное число шагов цепных дробей: kContinuedFractionMaxIterations плюс
+// kContinuedFractionIterationsPerRoot * sqrt(max(a, b)) для неполной бета-функции
+const double kContinuedFractionEpsilon = 1e-15;
+const int kContinuedFractionMaxIterations = 1000;
+const double kContinuedFractionIterationsPerRoot = 10;
+
+// Поправка Стирлинга lgamma(z + 1) - ((z + 0.5) ln z - z + ln(2 pi) / 2), z > 0
+[[nodiscard]] double StirlingError(double z);
+
+// Отклонение k ln(k / m) + m - k без потери точности при k, близком к m (Loader, 2000)
+[[nodiscard]] double Deviance(double k, double m);
+
+// Регуляризованная неполная бета-функция I_x(a, b), a > 0, b > 0.
+// Цепная дробь по алгоритму Ленца (Numerical Recipes, 6.4); при x > (a + 1) / (a + b + 2) считается
+// через I_x(a, b) = 1 - I_{1-x}(b, a), где дробь сходится быстро. Если дробь не сошлась, бросает std::runtime_error
+[[nodiscard]] double RegularizedIncompleteBeta(double a, double b, double x);
+
+// Квантиль N(0, 1), 0 < p < 1. Алгоритм AS 241 (Wichura, 1988), относительная погрешность около 1e-16
+[[nodiscard]] double StandardNormalQuantile(double p);
+
+// Уровень доверия по умолчанию для нормальных интервалов mean -+ z * SE, z = StandardNormalQuantile((1 + level) / 2)
+const double kDefaultConfidenceLevel = 0.95;
+
+} // namespace ptm
+
+#endif // PTM_SPECIALFUNCTIONS_HPP_
@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "ExponentialDistribution.hpp"
+#include "LaplaceDistribution.hpp"
+#include "MomentAccumulator.hpp"
+#include "NormalDistribution.hpp"
+#include "TailImportanceSampler.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Проверка до разыменования в делегирующем инициализаторе
+const Distribution& CheckedTarget(const std::shared_ptr<Distribution>& target) {
+  if (!target)
+    throw std::invalid_argument("Importance sampling needs target and proposal distributions");
+
+  return *target;
+}
+
+} // namespace
+
+TailImportanceSampler::TailImportanceSampler(std::shared_ptr<Distribution> target, double threshold) :
+    TailImportanceSampler(target, DefaultProposal(CheckedTarget(target), threshold), threshold) {
+}
+
+TailImportanceSampler::TailImportanceSampler(std::shared_ptr<Distribution> target,
+                                             std::shared_ptr<Distribution> proposal,
+                                             double threshold) :
+    target_(std::move(target)), proposal_(std::move(proposal)), threshold_(threshold) {
+  if (!target_ || !proposal_)
+    throw std::invalid_argument("Importance sampling needs target and proposal distributions");
+}
+
+std::shared_ptr<Distribution> TailImportanceSampler::DefaultProposal(const Distribution& target, double threshold) {
+  if (const auto* normal = dynamic_cast<const NormalDistribution*>(&target))
+    return std::make_shared<NormalDistribution>(std::max(threshold, normal->GetMean()), normal->GetStddev());
+
+  if (const auto* exponential = dynamic_cast<const ExponentialDistribution*>(&target)) {
+    const double lambda = exponential->GetLambda();
+
+    return std::make_shared<ExponentialDistribution>(threshold > 1 / lambda ? 1 / threshold : lambda);
+  }
+
+  if (const auto* laplace = dynamic_cast<const LaplaceDistribution*>(&target))
+    return std::make_shared<LaplaceDistribution>(std::max(threshold, laplace->GetMu()), laplace->GetScale());
+
+  throw std::invalid_argument("No default importance sampling proposal for this distribution");
+}
+
+template <RandomEngine Engine>
+TailEstimate TailImportanceSampler::Estimate(Engine& rng, std::size_t sample_size) const {
+  if (sample_size < 2)
+    throw std::invalid_argument("Importance sampling needs at least two samples");
+
+  std::vector<double> samples(std::min(kSampleBatchSize, sample_size));
+  std::vector<double> target_pdf(samples.size());
+  std::vector<double> proposal_pdf(samples.size());
+  MomentAccumulator contributions;
+
+  for (std::size_t offset = 0; offset < sample_size; offset += kSampleBatchSize) {
+    const std::size_t count = std::min(kSampleBatchSize, sample_size - offset);
+    std::span<double> y(samples.data(), count);
+    std::span<double> f(target_pdf.data(), count);
+    std::span<double> g(proposal_pdf.data(), count);
+
+    proposal_->SampleBatch(rng, y);
+    target_->PdfBatch(y, f);
+    proposal_->PdfBatch(y, g);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      f[i] = y[i] > threshold_ ? f[i] / g[i] : 0.0;
+    }
+
+    contributions.AddBatch(f);
+  }
+
+  const double mean = contributions.Mean();
+  const double second_moment = contributions.Variance() + mean * mean;
+  const auto n = static_cast<double>(sample_size);
+
+  TailEstimate result;
+  result.probability = mean;
+  result.standard_error = std::sqrt(contributions.Variance() / (n - 1));
+  result.relative_error = result.standard_error / mean;
+  result.effective_sample_size = second_moment > 0 ? n * mean * mean / second_moment : 0.0;
+  result.sample_size = sample_size;
+
+  return result;
+}
+
+const Distribution& TailImportanceSampler::Proposal() const noexcept {
+  return *proposal_;
+}
+
+template TailEstimate TailImportanceSampler::Estimate(std::mt19937& rng, std::size_t sample_size) const;
+template TailEstimate TailImportanceSampler::Estimate(Philox4x32& rng, std::size_t sample_size) const;
+
+} // namespace ptm
@@ -0,0 +1,54 @@
+#ifndef PTM_TAILIMPORTANCESAMPLER_HPP_
+#define PTM_TAILIMPORTANCESAMPLER_HPP_
+
+#include <cstddef>
+#include <memory>
+
+#include "Distribution.hpp"
+
+namespace ptm {
+
+// Оценка вероятности хвоста P(X > t)
+struct TailEstimate {
+  double probability = 0.0;
+  double standard_error = 0.0;
+  double relative_error = 0.0; // standard_error / probability
+
+  // Эффективный размер выборки по Кишу (sum v)^2 / sum v^2 для вкладов v_i = w_i * 1{Y_i > t}:
+  // сколько независимых сэмплов с равными весами дали бы ту же точность
+  double effective_sample_size = 0.0;
+  std::size_t sample_size = 0;
+};
+
+// Выборка по значимости для P(X > t): Y_i берутся из предложения g, вклад сэмпла -
+// отношение правдоподобия w = f(Y) / g(Y) (по PdfBatch обоих распределений) при Y > t.
+// Для редкого хвоста p нужно O(1 / p) обычных сэмплов и O(1) сэмплов из удачного предложения
+class TailImportanceSampler {
+public:
+  // Предложение по умолчанию (DefaultProposal)
+  TailImportanceSampler(std::shared_ptr<Distribution> target, double threshold);
+
+  TailImportanceSampler(std::shared_ptr<Distribution> target,
+                        std::shared_ptr<Distribution> proposal,
+                        double threshold);
+
+  // Предложение для хвоста за t: N(t, sigma) для нормального (сдвиг, он же экспоненциальный наклон),
+  // Exp(1 / t) для экспоненциального (наклон до среднего t), Laplace(t, b) для Лапласа.
+  // Если t не правее центра, хвост не редкий и предложение - само распределение.
+  // Для остальных распределений - std::invalid_argument: предложение нужно передать явно
+  [[nodiscard]] static std::shared_ptr<Distribution> DefaultProposal(const Distribution& target, double threshold);
+
+  template <RandomEngine Engine>
+  TailEstimate Estimate(Engine& rng, std::size_t sample_size) const;
+
+  [[nodiscard]] const Distribution& Proposal() const noexcept;
+
+private:
+  std::shared_ptr<Distribution> target_;
+  std::shared_ptr<Distribution> proposal_;
+  double threshold_;
+};
+
+} // namespace ptm
+
+#endif // PTM_TAILIMPORTANCESAMPLER_HPP_
@@ -1,4 +1,7 @@
+#include <algorithm>
+
 #include "UniformDistribution.hpp"
+#include "VectorMath.hpp"
 
 namespace ptm {
 
@@ -21,10 +24,46 @@ double UniformDistribution::Cdf(double x) const {
   return (x - a_) / (b_ - a_);
 }
 
+double UniformDistribution::Quantile(double p) const {
+  CheckProbability(p);
+
+  return a_ + p * (b_ - a_);
+}
+
+std::optional<double> UniformDistribution::SymmetryCenter() const {
+  return (a_ + b_) / 2;
+}
+
+void UniformDistribution::PdfBatch(std::span<const double> x, std::span<double> out) const {
+  const double density = 1 / (b_ - a_);
+
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    out[i] = x[i] < a_ || x[i] > b_ ? 0.0 : density;
+  }
+}
+
+void UniformDistribution::CdfBatch(std::span<const double> x, std::span<double> out) const {
+  const double scale = 1 / (b_ - a_);
+
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    out[i] = std::clamp((x[i] - a_) * scale, 0.0, 1.0);
+  }
+}
+
 double UniformDistribution::Sample(std::mt19937& rng) const {
-  std::uniform_real_distribution distribution(a_, b_);
+  return SampleImpl(rng);
+}
 
-  return distribution(rng);
+double UniformDistribution::Sample(Philox4x32& rng) const {
+  return SampleImpl(rng);
+}
+
+void UniformDistribution::SampleBatch(std::mt19937& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
+}
+
+void UniformDistribution::SampleBatch(Philox4x32& rng, std::span<double> out) const {
+  SampleBatchImpl(rng, out);
 }
 
 double UniformDistribution::TheoreticalMean() const {
@@ -35,4 +74,20 @@ double UniformDistribution::TheoreticalVariance() const {
   return std::pow(b_ - a_, 2) / kUniformVarianceConstant;
 }
 
+template <RandomEngine Engine>
+double UniformDistribution::SampleImpl(Engine& rng) const {
+  std::uniform_real_distribution distribution(a_, b_);
+
+  return distribution(rng);
+}
+
+template <RandomEngine Engine>
+void UniformDistribution::SampleBatchImpl(Engine& rng, std::span<double> out) const {
+  std::uniform_real_distribution distribution(a_, b_);
+
+  for (double& value : out) {
+    value = distribution(rng);
+  }
+}
+
 } // namespace ptm
@@ -10,13 +10,20 @@ namespace ptm {
 const double kUniformVarianceConstant = 12.0;
 
 // Равномерное U(a, b)
-class UniformDistribution : public Distribution {
+class UniformDistribution final : public Distribution {
 public:
   UniformDistribution(double a, double b);
 
   [[nodiscard]] double Pdf(double x) const override;
   [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double p) const override;
+  [[nodiscard]] std::optional<double> SymmetryCenter() const override;
+  void PdfBatch(std::span<const double> x, std::span<double> out) const override;
+  void CdfBatch(std::span<const double> x, std::span<double> out) const override;
   double Sample(std::mt19937& rng) const override;
+  double Sample(Philox4x32& rng) const override;
+  void SampleBatch(std::mt19937& rng, std::span<double> out) const override;
+  void SampleBatch(Philox4x32& rng, std::span<double> out) const override;
 
   [[nodiscard]] double TheoreticalMean() const override;
   [[nodiscard]] double TheoreticalVariance() const override;
@@ -24,6 +31,12 @@ public:
 private:
   double a_;
   double b_;
+
+  template <RandomEngine Engine>
+  double SampleImpl(Engine& rng) const;
+
+  template <RandomEngine Engine>
+  void SampleBatchImpl(Engine& rng, std::span<double> out) const;
 };
 
 } // namespace ptm
@@ -0,0 +1,20 @@
+#ifndef PTM_VARIANCEREDUCTIONSTATS_HPP_
+#define PTM_VARIANCEREDUCTIONSTATS_HPP_
+
+#include "ExperimentStats.hpp"
+
+namespace ptm {
+
+// Итог эксперимента с понижением дисперсии: stats.empirical_mean - оценка матожидания, остальные поля stats -
+// по всем сгенерированным значениям. variance_reduction = plain_standard_error^2 / mean_standard_error^2 -
+// во сколько раз больше независимых сэмплов понадобилось бы обычному Монте-Карло для той же точности
+struct VarianceReductionStats {
+  ExperimentStats stats;
+  double mean_standard_error = 0.0;
+  double plain_standard_error = 0.0; // sigma / sqrt(N) для N независимых сэмплов
+  double variance_reduction = 0.0;
+};
+
+} // namespace ptm
+
+#endif // PTM_VARIANCEREDUCTIONSTATS_HPP_
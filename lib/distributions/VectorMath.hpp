@@ -0,0 +1,136 @@
+#ifndef PTM_VECTORMATH_HPP_
+#define PTM_VECTORMATH_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+
+namespace ptm {
+
+// Скалярные exp/Ф/atan без ветвлений и вызовов libm.
+// Рассчитаны на тела циклов CdfBatch/PdfBatch: все развилки - выбор между уже посчитанными значениями,
+// поэтому компилятор векторизует такие циклы (SSE2 по умолчанию, AVX2 с PTM_NATIVE_ARCH).
+
+const double kFastExpMax = 709.0;
+const double kFastExpMin = -708.0;
+const double kRoundToIntegerShift = 6755399441055744.0; // 1.5 * 2^52: x + shift - shift округляет x до целого
+const double kLn2High = 6.93145751953125e-1;
+const double kLn2Low = 1.42860682030941723212e-6;
+
+// Коэффициенты рациональных приближений Cephes, старшая степень первой
+const std::array<double, 3> kExpNumerator = {
+    1.26177193074810590878e-4,
+    3.02994407707441961300e-2,
+    9.99999999999999999910e-1,
+};
+const std::array<double, 4> kExpDenominator = {
+    3.00198505138664455042e-6,
+    2.52448340349684104192e-3,
+    2.27265548208155028766e-1,
+    2.00000000000000000009e0,
+};
+
+const double kTan3PiOver8 = 2.41421356237309504880;
+const double kAtanMiddleBorder = 0.66;
+const double kAtanMoreBits = 6.123233995736765886130e-17;
+const std::array<double, 5> kAtanNumerator = {
+    -8.750608600031904122785e-1,
+    -1.615753718733365076637e1,
+    -7.500855792314704667340e1,
+    -1.228866684490136173410e2,
+    -6.485021904942025371773e1,
+};
+const std::array<double, 6> kAtanDenominator = {
+    1.0,
+    2.485846490142306297962e1,
+    1.650270098316988542046e2,
+    4.328810604912902668951e2,
+    4.853903996359136964868e2,
+    1.945506571482613964425e2,
+};
+
+// Алгоритм Hart 5666 для хвоста нормального распределения (Hart, 1968; West, 2005)
+const double kNormalTailBorder = 7.07106781186547;
+const double kNormalTailFractionShift = 0.65;
+const double kInvSqrt2Pi = 0.398942280401432677940;
+const std::array<double, 7> kNormalTailNumerator = {
+    0.0352624965998911,
+    0.700383064443688,
+    6.37396220353165,
+    33.912866078383,
+    112.079291497871,
+    221.213596169931,
+    220.206867912376,
+};
+const std::array<double, 8> kNormalTailDenominator = {
+    0.0883883476483184,
+    1.75566716318264,
+    16.064177579207,
+    86.7807322029461,
+    296.564248779674,
+    637.333633378831,
+    793.826512519948,
+    440.413735824752,
+};
+
+template <std::size_t N>
+double Horner(double x, const std::array<double, N>& coefficients) {
+  double result = 0;
+
+  for (double coefficient : coefficients) {
+    result = result * x + coefficient;
+  }
+
+  return result;
+}
+
+// exp(x); 0 при x < -708, +inf при x > 709
+inline double FastExp(double x) {
+  const double clamped = std::min(std::max(x, kFastExpMin), kFastExpMax);
+  const double shifted = clamped * std::numbers::log2e + kRoundToIntegerShift;
+  const double n = shifted - kRoundToIntegerShift;
+  const double r = clamped - n * kLn2High - n * kLn2Low;
+  const double rr = r * r;
+  const double p = r * Horner(rr, kExpNumerator);
+  const double exp_r = 1 + 2 * p / (Horner(rr, kExpDenominator) - p);
+
+  // В младших битах shifted лежит n; 2^n собираем прямо в поле экспоненты
+  const double scale = std::bit_cast<double>((std::bit_cast<std::uint64_t>(shifted) + 1023) << 52);
+
+  return x > kFastExpMax ? HUGE_VAL : (x < kFastExpMin ? 0.0 : exp_r * scale);
+}
+
+// Функция распределения N(0, 1); абсолютная погрешность порядка 1e-16
+inline double FastStandardNormalCdf(double x) {
+  const double z = std::abs(x);
+  const double density = FastExp(-z * z / 2);
+  const double near_tail = density * Horner(z, kNormalTailNumerator) / Horner(z, kNormalTailDenominator);
+  const double fraction = z + 1 / (z + 2 / (z + 3 / (z + 4 / (z + kNormalTailFractionShift))));
+  const double far_tail = kInvSqrt2Pi * density / fraction;
+  const double tail = z < kNormalTailBorder ? near_tail : far_tail;
+
+  return x > 0 ? 1 - tail : tail;
+}
+
+inline double FastAtan(double x) {
+  const double a = std::abs(x);
+  const bool large = a > kTan3PiOver8;
+  const bool middle = a > kAtanMiddleBorder;
+
+  // Сведение к |reduced| <= 0.66: atan(a) = pi/2 + atan(-1/a) или pi/4 + atan((a-1)/(a+1))
+  const double offset = large ? std::numbers::pi / 2 : (middle ? std::numbers::pi / 4 : 0.0);
+  const double correction = large ? kAtanMoreBits : (middle ? kAtanMoreBits / 2 : 0.0);
+  const double reduced = large ? -1 / a : (middle ? (a - 1) / (a + 1) : a);
+  const double z = reduced * reduced;
+  const double tail = reduced * z * Horner(z, kAtanNumerator) / Horner(z, kAtanDenominator) + correction;
+
+  return std::copysign(offset + (reduced + tail), x);
+}
+
+} // namespace ptm
+
+#endif // PTM_VECTORMATH_HPP_
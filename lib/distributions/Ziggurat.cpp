@@ -0,0 +1,253 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+#include "RandomBits.hpp"
+#include "Ziggurat.hpp"
+
+namespace ptm {
+
+namespace {
+
+const std::size_t kZigguratBlockSize = 256;
+
+const std::size_t kNormalLayers = 128;
+const std::uint64_t kNormalLayerMask = kNormalLayers - 1;
+const std::uint64_t kNormalSignBit = kNormalLayers;
+const double kNormalR = 3.442619855899;      // правая граница основания
+const double kNormalV = 9.91256303526217e-3; // площадь каждого слоя
+
+// x[i] - правая граница слоя i, f[i] = exp(-x[i]^2 / 2).
+// Слой 0 - основание вместе с хвостом, его "ширина" x[0] = V / f(R)
+struct NormalTables {
+  std::array<double, kNormalLayers + 1> x;
+  std::array<double, kNormalLayers + 1> f;
+};
+
+NormalTables BuildNormalTables() {
+  NormalTables tables{};
+  const double f_r = std::exp(-kNormalR * kNormalR / 2);
+
+  tables.x[0] = kNormalV / f_r;
+  tables.x[1] = kNormalR;
+
+  for (std::size_t i = 1; i + 1 < kNormalLayers; ++i) {
+    tables.x[i + 1] = std::sqrt(-2 * std::log(kNormalV / tables.x[i] + std::exp(-tables.x[i] * tables.x[i] / 2)));
+  }
+
+  tables.x[kNormalLayers] = 0;
+
+  for (std::size_t i = 0; i <= kNormalLayers; ++i) {
+    tables.f[i] = std::exp(-tables.x[i] * tables.x[i] / 2);
+  }
+
+  return tables;
+}
+
+const NormalTables kNormal = BuildNormalTables();
+
+const std::size_t kExponentialLayers = 256;
+const std::uint64_t kExponentialLayerMask = kExponentialLayers - 1;
+const std::uint64_t kExponentialSignBit = kExponentialLayers;
+const double kExponentialR = 7.69711747013104972;
+const double kExponentialV = 3.949659822581572e-3;
+
+// x[i] - правая граница слоя i, f[i] = exp(-x[i])
+struct ExponentialTables {
+  std::array<double, kExponentialLayers + 1> x;
+  std::array<double, kExponentialLayers + 1> f;
+};
+
+ExponentialTables BuildExponentialTables() {
+  ExponentialTables tables{};
+
+  tables.x[0] = kExponentialV / std::exp(-kExponentialR);
+  tables.x[1] = kExponentialR;
+
+  for (std::size_t i = 1; i + 1 < kExponentialLayers; ++i) {
+    tables.x[i + 1] = -std::log(kExponentialV / tables.x[i] + std::exp(-tables.x[i]));
+  }
+
+  tables.x[kExponentialLayers] = 0;
+
+  for (std::size_t i = 0; i <= kExponentialLayers; ++i) {
+    tables.f[i] = std::exp(-tables.x[i]);
+  }
+
+  return tables;
+}
+
+const ExponentialTables kExponential = BuildExponentialTables();
+
+double SignedValue(std::uint64_t bits, std::uint64_t sign_bit, double value) {
+  return (bits & sign_bit) != 0 ? -value : value;
+}
+
+// Хвост |x| > R методом Марсальи
+template <RandomEngine Engine>
+double NormalTail(Engine& rng) {
+  double a = 0;
+  double b = 0;
+
+  do {
+    a = -std::log(BitsToOpenUnit(NextBits64(rng))) / kNormalR;
+    b = -std::log(BitsToOpenUnit(NextBits64(rng)));
+  } while (b + b < a * a);
+
+  return kNormalR + a;
+}
+
+// Продолжение ziggurat-шага для кандидата x из слоя layer, не прошедшего быстрый тест
+template <RandomEngine Engine>
+double NormalSlowPath(Engine& rng, std::uint64_t layer, double x) {
+  if (layer == 0)
+    return std::copysign(NormalTail(rng), x);
+
+  double y = kNormal.f[layer] + BitsToUnit(NextBits64(rng)) * (kNormal.f[layer + 1] - kNormal.f[layer]);
+
+  if (y < std::exp(-x * x / 2))
+    return x;
+
+  return StandardNormal(rng);
+}
+
+// Случайная высота внутри слоя layer для проверки клина
+double ExponentialWedgeHeight(std::uint64_t layer, std::uint64_t bits) {
+  return kExponential.f[layer] + BitsToUnit(bits) * (kExponential.f[layer + 1] - kExponential.f[layer]);
+}
+
+// Ziggurat для Exp(1); при sign_bit != 0 соответствующий бит слова задаёт знак (Лаплас)
+template <RandomEngine Engine>
+double ExponentialVariate(Engine& rng, std::uint64_t sign_bit) {
+  while (true) {
+    const std::uint64_t bits = NextBits64(rng);
+    const std::uint64_t layer = bits & kExponentialLayerMask;
+    const double x = BitsToUnit(bits) * kExponential.x[layer];
+
+    if (x < kExponential.x[layer + 1])
+      return SignedValue(bits, sign_bit, x);
+
+    // Хвост экспоненты без памяти: R + Exp(1)
+    if (layer == 0)
+      return SignedValue(bits, sign_bit, kExponentialR - std::log(BitsToOpenUnit(NextBits64(rng))));
+
+    if (ExponentialWedgeHeight(layer, NextBits64(rng)) < std::exp(-x))
+      return SignedValue(bits, sign_bit, x);
+  }
+}
+
+template <RandomEngine Engine>
+void FillExponentialVariates(Engine& rng, std::span<double> out, std::uint64_t sign_bit) {
+  std::array<std::uint64_t, kZigguratBlockSize> bits{};
+
+  for (std::size_t offset = 0; offset < out.size(); offset += kZigguratBlockSize) {
+    std::span<double> block = out.subspan(offset, std::min(kZigguratBlockSize, out.size() - offset));
+
+    for (std::size_t j = 0; j < block.size(); ++j) {
+      bits[j] = NextBits64(rng);
+    }
+
+    for (std::size_t j = 0; j < block.size(); ++j) {
+      const double x = BitsToUnit(bits[j]) * kExponential.x[bits[j] & kExponentialLayerMask];
+      block[j] = SignedValue(bits[j], sign_bit, x);
+    }
+
+    for (std::size_t j = 0; j < block.size(); ++j) {
+      const std::uint64_t layer = bits[j] & kExponentialLayerMask;
+      const double x = std::abs(block[j]);
+
+      if (x < kExponential.x[layer + 1])
+        continue;
+
+      if (layer == 0) {
+        block[j] = SignedValue(bits[j], sign_bit, kExponentialR - std::log(BitsToOpenUnit(NextBits64(rng))));
+        continue;
+      }
+
+      if (ExponentialWedgeHeight(layer, NextBits64(rng)) >= std::exp(-x))
+        block[j] = ExponentialVariate(rng, sign_bit);
+    }
+  }
+}
+
+} // namespace
+
+template <RandomEngine Engine>
+double StandardNormal(Engine& rng) {
+  while (true) {
+    const std::uint64_t bits = NextBits64(rng);
+    const std::uint64_t layer = bits & kNormalLayerMask;
+    const double x = BitsToUnit(bits) * kNormal.x[layer];
+
+    if (x < kNormal.x[layer + 1])
+      return SignedValue(bits, kNormalSignBit, x);
+
+    if (layer == 0)
+      return SignedValue(bits, kNormalSignBit, NormalTail(rng));
+
+    double y = kNormal.f[layer] + BitsToUnit(NextBits64(rng)) * (kNormal.f[layer + 1] - kNormal.f[layer]);
+
+    if (y < std::exp(-x * x / 2))
+      return SignedValue(bits, kNormalSignBit, x);
+  }
+}
+
+template <RandomEngine Engine>
+void FillStandardNormal(Engine& rng, std::span<double> out) {
+  std::array<std::uint64_t, kZigguratBlockSize> bits{};
+
+  for (std::size_t offset = 0; offset < out.size(); offset += kZigguratBlockSize) {
+    std::span<double> block = out.subspan(offset, std::min(kZigguratBlockSize, out.size() - offset));
+
+    for (std::size_t j = 0; j < block.size(); ++j) {
+      bits[j] = NextBits64(rng);
+    }
+
+    for (std::size_t j = 0; j < block.size(); ++j) {
+      block[j] = SignedValue(bits[j], kNormalSignBit, BitsToUnit(bits[j]) * kNormal.x[bits[j] & kNormalLayerMask]);
+    }
+
+    for (std::size_t j = 0; j < block.size(); ++j) {
+      const std::uint64_t layer = bits[j] & kNormalLayerMask;
+
+      if (std::abs(block[j]) >= kNormal.x[layer + 1])
+        block[j] = NormalSlowPath(rng, layer, block[j]);
+    }
+  }
+}
+
+template <RandomEngine Engine>
+double StandardExponential(Engine& rng) {
+  return ExponentialVariate(rng, 0);
+}
+
+template <RandomEngine Engine>
+void FillStandardExponential(Engine& rng, std::span<double> out) {
+  FillExponentialVariates(rng, out, 0);
+}
+
+template <RandomEngine Engine>
+double StandardLaplace(Engine& rng) {
+  return ExponentialVariate(rng, kExponentialSignBit);
+}
+
+template <RandomEngine Engine>
+void FillStandardLaplace(Engine& rng, std::span<double> out) {
+  FillExponentialVariates(rng, out, kExponentialSignBit);
+}
+
+template double StandardNormal(std::mt19937& rng);
+template double StandardNormal(Philox4x32& rng);
+template void FillStandardNormal(std::mt19937& rng, std::span<double> out);
+template void FillStandardNormal(Philox4x32& rng, std::span<double> out);
+template double StandardExponential(std::mt19937& rng);
+template double StandardExponential(Philox4x32& rng);
+template void FillStandardExponential(std::mt19937& rng, std::span<double> out);
+template void FillStandardExponential(Philox4x32& rng, std::span<double> out);
+template double StandardLaplace(std::mt19937& rng);
+template double StandardLaplace(Philox4x32& rng);
+template void FillStandardLaplace(std::mt19937& rng, std::span<double> out);
+template void FillStandardLaplace(Philox4x32& rng, std::span<double> out);
+
+} // namespace ptm
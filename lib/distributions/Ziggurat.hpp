@@ -0,0 +1,38 @@
+#ifndef PTM_ZIGGURAT_HPP_
+#define PTM_ZIGGURAT_HPP_
+
+#include <span>
+
+#include "random/RandomEngine.hpp"
+
+namespace ptm {
+
+// Табличные ziggurat-ядра (Marsaglia, Tsang) для непрерывных распределений.
+// Одно 64-битное слово даёт номер слоя, знак и 53-битное равномерное число,
+// поэтому в ~99% случаев вариата стоит два вызова 32-битного генератора и ни одного exp/log.
+
+// Стандартное нормальное N(0, 1)
+template <RandomEngine Engine>
+double StandardNormal(Engine& rng);
+
+// Заполнение буфера значениями N(0, 1).
+// Быстрый путь считается по блоку заранее сгенерированных слов без ветвлений и векторизуется компилятором,
+// редкие отказы (клин и хвост) дорабатываются скалярно.
+template <RandomEngine Engine>
+void FillStandardNormal(Engine& rng, std::span<double> out);
+
+// Стандартное экспоненциальное Exp(1)
+template <RandomEngine Engine>
+double StandardExponential(Engine& rng);
+template <RandomEngine Engine>
+void FillStandardExponential(Engine& rng, std::span<double> out);
+
+// Стандартное Лапласа Laplace(0, 1): Exp(1) со знаком из свободного бита того же слова
+template <RandomEngine Engine>
+double StandardLaplace(Engine& rng);
+template <RandomEngine Engine>
+void FillStandardLaplace(Engine& rng, std::span<double> out);
+
+} // namespace ptm
+
+#endif // PTM_ZIGGURAT_HPP_
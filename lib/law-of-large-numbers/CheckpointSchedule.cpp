@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+#include "CheckpointSchedule.hpp"
+
+namespace ptm {
+
+namespace {
+
+const std::size_t kNoCheckpoint = std::numeric_limits<std::size_t>::max();
+
+// Точки дальше 2^63 не нужны ни одной траектории и не помещаются в size_t после округления
+const double kMaxGeometricCheckpoint = 9.2e18;
+
+void CheckPoints(const std::vector<std::size_t>& points) {
+  if (!points.empty() && points.front() == 0)
+    throw std::invalid_argument("Checkpoints must be positive");
+
+  if (std::adjacent_find(points.begin(), points.end(), std::greater_equal<>()) != points.end())
+    throw std::invalid_argument("Checkpoints must be strictly increasing");
+}
+
+} // namespace
+
+CheckpointSchedule CheckpointSchedule::Linear(std::size_t step) {
+  if (step == 0)
+    throw std::invalid_argument("LLN step must be positive");
+
+  CheckpointSchedule schedule;
+  schedule.step_ = step;
+
+  return schedule;
+}
+
+CheckpointSchedule CheckpointSchedule::Geometric(std::size_t first, double ratio) {
+  if (first == 0 || !(ratio > 1) || !std::isfinite(ratio))
+    throw std::invalid_argument("Geometric checkpoints need first > 0 and ratio > 1");
+
+  CheckpointSchedule schedule;
+  schedule.first_ = first;
+  schedule.ratio_ = ratio;
+
+  return schedule;
+}
+
+CheckpointSchedule CheckpointSchedule::LogSpaced(std::size_t first, std::size_t points_per_decade) {
+  if (points_per_decade == 0)
+    throw std::invalid_argument("Log-spaced checkpoints need at least one point per decade");
+
+  return Geometric(first, std::pow(10.0, 1.0 / static_cast<double>(points_per_decade)));
+}
+
+CheckpointSchedule CheckpointSchedule::Explicit(std::vector<std::size_t> points) {
+  CheckPoints(points);
+
+  CheckpointSchedule schedule;
+  schedule.points_ = std::move(points);
+
+  return schedule;
+}
+
+CheckpointSchedule CheckpointSchedule::Hybrid(std::size_t first, double ratio, std::vector<std::size_t> points) {
+  CheckpointSchedule schedule = Geometric(first, ratio);
+  CheckPoints(points);
+  schedule.points_ = std::move(points);
+
+  return schedule;
+}
+
+std::size_t CheckpointSchedule::Next(std::size_t n) const {
+  std::size_t next = kNoCheckpoint;
+
+  if (step_ != 0 && n / step_ < kNoCheckpoint / step_)
+    next = (n / step_ + 1) * step_;
+
+  if (first_ != 0)
+    next = std::min(next, NextGeometric(n));
+
+  const auto it = std::upper_bound(points_.begin(), points_.end(), n);
+
+  if (it != points_.end())
+    next = std::min(next, *it);
+
+  return next;
+}
+
+std::vector<std::size_t> CheckpointSchedule::Points(std::size_t max_n) const {
+  std::vector<std::size_t> points;
+
+  for (std::size_t n = Next(0); n <= max_n && n != kNoCheckpoint; n = Next(n)) {
+    points.push_back(n);
+  }
+
+  return points;
+}
+
+std::size_t CheckpointSchedule::NextGeometric(std::size_t n) const {
+  if (n < first_)
+    return first_;
+
+  // Номер точки по логарифму, затем шаги вперёд: округление может склеить соседние точки
+  const double position = std::log(static_cast<double>(n) / static_cast<double>(first_)) / std::log(ratio_);
+  auto k = static_cast<double>(std::max(0.0, std::floor(position) - 1));
+
+  while (true) {
+    const double point = std::round(static_cast<double>(first_) * std::pow(ratio_, k));
+
+    if (point > kMaxGeometricCheckpoint)
+      return kNoCheckpoint;
+
+    if (point > static_cast<double>(n))
+      return static_cast<std::size_t>(point);
+
+    k += 1;
+  }
+}
+
+} // namespace ptm
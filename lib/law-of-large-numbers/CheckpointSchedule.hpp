@@ -0,0 +1,49 @@
+#ifndef PTM_CHECKPOINTSCHEDULE_HPP_
+#define PTM_CHECKPOINTSCHEDULE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace ptm {
+
+// Контрольные точки траектории LLN - значения n, в которых записывается LLNPathEntry.
+// Расписание - объединение линейной сетки step, 2 step, ..., геометрической round(first * ratio^k)
+// и явного списка; любая часть может отсутствовать. С геометрической частью число точек до max_n
+// логарифмическое: 10^2..10^10 по 10 точек на декаду - 81 запись вместо миллиардов
+class CheckpointSchedule {
+public:
+  // n = step, 2 step, 3 step, ...
+  [[nodiscard]] static CheckpointSchedule Linear(std::size_t step);
+
+  // n = round(first * ratio^k), k = 0, 1, ...; совпавшие после округления точки склеиваются
+  [[nodiscard]] static CheckpointSchedule Geometric(std::size_t first, double ratio);
+
+  // Геометрическая сетка с points_per_decade точками на каждую декаду, начиная с first
+  [[nodiscard]] static CheckpointSchedule LogSpaced(std::size_t first, std::size_t points_per_decade);
+
+  // Заданные точки; список должен строго возрастать и не содержать нуля
+  [[nodiscard]] static CheckpointSchedule Explicit(std::vector<std::size_t> points);
+
+  // Геометрическая сетка вместе с явными точками (например, частая сетка в начале траектории)
+  [[nodiscard]] static CheckpointSchedule Hybrid(std::size_t first, double ratio, std::vector<std::size_t> points);
+
+  // Ближайшая точка, строго большая n; SIZE_MAX, если таких нет
+  [[nodiscard]] std::size_t Next(std::size_t n) const;
+
+  // Все точки не больше max_n
+  [[nodiscard]] std::vector<std::size_t> Points(std::size_t max_n) const;
+
+private:
+  std::size_t step_ = 0;  // 0 - без линейной части
+  std::size_t first_ = 0; // 0 - без геометрической части
+  double ratio_ = 0;
+  std::vector<std::size_t> points_;
+
+  CheckpointSchedule() = default;
+
+  [[nodiscard]] std::size_t NextGeometric(std::size_t n) const;
+};
+
+} // namespace ptm
+
+#endif // PTM_CHECKPOINTSCHEDULE_HPP_
@@ -0,0 +1,61 @@
+#ifndef PTM_COMPENSATEDSUM_HPP_
+#define PTM_COMPENSATEDSUM_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+
+namespace ptm {
+
+// Блоки короче этого суммируются простым циклом
+const std::size_t kPairwiseSumBaseSize = 32;
+
+// Сумма с компенсацией Ноймайера: потерянные при округлении младшие биты копятся в отдельном слагаемом,
+// ошибка O(eps) вместо O(n eps) у простой суммы в double - среднее не портится и на 10^11 слагаемых.
+// Методы в заголовке, чтобы Add встраивался в горячие циклы
+class CompensatedSum {
+public:
+  void Add(double value) {
+    const double total = sum_ + value;
+
+    if (std::abs(sum_) >= std::abs(value))
+      compensation_ += (sum_ - total) + value;
+    else
+      compensation_ += (value - total) + sum_;
+
+    sum_ = total;
+  }
+
+  // Блок суммируется попарно (ошибка O(eps log B), цикл векторизуется), затем добавляется с компенсацией
+  void AddBatch(std::span<const double> values) {
+    Add(PairwiseSum(values));
+  }
+
+  [[nodiscard]] double Value() const noexcept {
+    return sum_ + compensation_;
+  }
+
+private:
+  double sum_ = 0;
+  double compensation_ = 0;
+
+  static double PairwiseSum(std::span<const double> values) {
+    if (values.size() <= kPairwiseSumBaseSize) {
+      double sum = 0;
+
+      for (double value : values) {
+        sum += value;
+      }
+
+      return sum;
+    }
+
+    const std::size_t half = values.size() / 2;
+
+    return PairwiseSum(values.first(half)) + PairwiseSum(values.subspan(half));
+  }
+};
+
+} // namespace ptm
+
+#endif // PTM_COMPENSATEDSUM_HPP_
@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "LLNEnsemble.hpp"
+#include "distributions/AnyDistribution.hpp"
+#include "distributions/ParallelFor.hpp"
+#include "random/Philox4x32.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Квантиль уровня p с линейной интерполяцией (тип 7 по Hyndman-Fan); values переставляется
+double Quantile(std::span<double> values, double p) {
+  const double position = p * static_cast<double>(values.size() - 1);
+  const auto index = static_cast<std::size_t>(position);
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+
+  if (index + 1 >= values.size())
+    return values[index];
+
+  const double next = *std::min_element(values.begin() + index + 1, values.end());
+
+  return values[index] + (position - static_cast<double>(index)) * (next - values[index]);
+}
+
+// Бегущие суммы путей: sum[i] и компенсация Кэхэна compensation[i] для пути i
+struct EnsembleState {
+  std::vector<double> sum;
+  std::vector<double> compensation;
+  std::vector<Philox4x32> rngs; // по генератору на группу
+};
+
+// Продвигает пути группы g на count шагов
+template <class D>
+void Advance(const D& dist, EnsembleState& state, std::size_t g, std::size_t count, std::span<double> buffer) {
+  const std::size_t first = g * kLLNEnsembleGroupSize;
+  const std::size_t width = std::min(kLLNEnsembleGroupSize, state.sum.size() - first);
+  const std::size_t rows_per_block = buffer.size() / width;
+  double* sum = state.sum.data() + first;
+  double* compensation = state.compensation.data() + first;
+  std::array<double, kLLNEnsembleGroupSize> partial{};
+
+  for (std::size_t done = 0; done < count;) {
+    const std::size_t rows = std::min(rows_per_block, count - done);
+    std::span<double> block = buffer.first(rows * width);
+    dist.SampleBatch(state.rngs[g], block);
+    std::fill(partial.begin(), partial.end(), 0.0);
+
+    for (std::size_t r = 0; r < rows; ++r) {
+      const double* row = block.data() + r * width;
+
+      for (std::size_t p = 0; p < width; ++p) {
+        partial[p] += row[p];
+      }
+    }
+
+    // Частичные суммы блока (не больше kSampleBatchSize слагаемых) добавляются с компенсацией
+    for (std::size_t p = 0; p < width; ++p) {
+      const double corrected = partial[p] - compensation[p];
+      const double total = sum[p] + corrected;
+      compensation[p] = (total - sum[p]) - corrected;
+      sum[p] = total;
+    }
+
+    done += rows;
+  }
+}
+
+template <class D>
+void RunEnsemble(const D& dist,
+                 std::uint64_t seed,
+                 std::size_t threads,
+                 std::span<const double> levels,
+                 LLNEnsembleResult& result,
+                 std::vector<double>& medians) {
+  const std::size_t paths = result.paths;
+  const std::size_t checkpoints = result.n.size();
+  const std::size_t groups = (paths + kLLNEnsembleGroupSize - 1) / kLLNEnsembleGroupSize;
+  const double theoretical_mean = dist.TheoreticalMean();
+
+  EnsembleState state{std::vector<double>(paths), std::vector<double>(paths), {}};
+  state.rngs.reserve(groups);
+
+  for (std::size_t g = 0; g < groups; ++g) {
+    state.rngs.emplace_back(seed, g);
+  }
+
+  const std::size_t window = std::max<std::size_t>(1, kLLNEnsembleWindowValues / paths);
+  std::vector<double> errors(std::min(window, checkpoints) * paths);
+
+  for (std::size_t window_begin = 0; window_begin < checkpoints; window_begin += window) {
+    const std::size_t window_size = std::min(window, checkpoints - window_begin);
+
+    ParallelFor(groups, threads, [&](std::size_t g) {
+      std::vector<double> buffer(kSampleBatchSize);
+      const std::size_t first = g * kLLNEnsembleGroupSize;
+      const std::size_t width = std::min(kLLNEnsembleGroupSize, paths - first);
+
+      for (std::size_t k = 0; k < window_size; ++k) {
+        const std::size_t checkpoint = window_begin + k;
+        const std::size_t previous = checkpoint == 0 ? 0 : result.n[checkpoint - 1];
+        Advance(dist, state, g, result.n[checkpoint] - previous, buffer);
+        const auto n = static_cast<double>(result.n[checkpoint]);
+        double* row = errors.data() + k * paths + first;
+
+        for (std::size_t p = 0; p < width; ++p) {
+          row[p] = std::abs((state.sum[first + p] - state.compensation[first + p]) / n - theoretical_mean);
+        }
+      }
+    });
+
+    for (std::size_t k = 0; k < window_size; ++k) {
+      std::span<double> row(errors.data() + k * paths, paths);
+
+      for (std::size_t j = 0; j < levels.size(); ++j) {
+        result.abs_error_quantiles[j][window_begin + k] = Quantile(row, levels[j]);
+      }
+
+      medians[window_begin + k] = Quantile(row, 0.5);
+    }
+  }
+}
+
+// Наклон МНК-прямой log(error) от log(n) по точкам с положительной конечной ошибкой
+double ConvergenceExponent(const std::vector<std::size_t>& n, const std::vector<double>& errors) {
+  double count = 0;
+  double sum_x = 0;
+  double sum_y = 0;
+  double sum_xx = 0;
+  double sum_xy = 0;
+
+  for (std::size_t k = 0; k < n.size(); ++k) {
+    if (!(errors[k] > 0) || !std::isfinite(errors[k]))
+      continue;
+
+    const double x = std::log(static_cast<double>(n[k]));
+    const double y = std::log(errors[k]);
+    count += 1;
+    sum_x += x;
+    sum_y += y;
+    sum_xx += x * x;
+    sum_xy += x * y;
+  }
+
+  const double denominator = count * sum_xx - sum_x * sum_x;
+
+  if (count < 2 || denominator <= 0)
+    return std::numeric_limits<double>::quiet_NaN();
+
+  return (count * sum_xy - sum_x * sum_y) / denominator;
+}
+
+} // namespace
+
+LLNEnsemble::LLNEnsemble(std::shared_ptr<Distribution> dist, std::size_t paths) :
+    dist_(std::move(dist)), paths_(paths) {
+  if (paths < 2)
+    throw std::invalid_argument("LLN ensemble needs at least two paths");
+}
+
+LLNEnsembleResult LLNEnsemble::Run(std::uint64_t seed,
+                                   std::size_t max_n,
+                                   std::size_t step,
+                                   std::size_t threads,
+                                   std::span<const double> quantile_levels) const {
+  return Run(seed, max_n, CheckpointSchedule::Linear(step), threads, quantile_levels);
+}
+
+LLNEnsembleResult LLNEnsemble::Run(std::uint64_t seed,
+                                   std::size_t max_n,
+                                   const CheckpointSchedule& schedule,
+                                   std::size_t threads,
+                                   std::span<const double> quantile_levels) const {
+  if (!std::isfinite(dist_->TheoreticalMean()))
+    throw std::invalid_argument("LLN ensemble errors need a finite theoretical mean");
+
+  for (double level : quantile_levels) {
+    if (!(level >= 0 && level <= 1))
+      throw std::invalid_argument("Quantile level must lie in [0, 1]");
+  }
+
+  LLNEnsembleResult result;
+  result.paths = paths_;
+  result.quantile_levels.assign(quantile_levels.begin(), quantile_levels.end());
+  result.n = schedule.Points(max_n);
+
+  result.abs_error_quantiles.assign(quantile_levels.size(), std::vector<double>(result.n.size()));
+  std::vector<double> medians(result.n.size());
+
+  VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    RunEnsemble(*dist, seed, threads, quantile_levels, result, medians);
+  });
+
+  result.convergence_exponent = ConvergenceExponent(result.n, medians);
+
+  return result;
+}
+
+} // namespace ptm
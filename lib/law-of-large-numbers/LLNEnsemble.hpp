@@ -0,0 +1,67 @@
+#ifndef PTM_LLNENSEMBLE_HPP_
+#define PTM_LLNENSEMBLE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "CheckpointSchedule.hpp"
+#include "distributions/Distribution.hpp"
+
+namespace ptm {
+
+const std::array<double, 3> kLLNEnsembleQuantileLevels = {0.05, 0.5, 0.95};
+
+// Путей в группе: у группы свой генератор Philox4x32(seed, g), сэмплы блока раскладываются
+// по строкам [шаг][путь], и одна строка продвигает все пути группы векторизуемым циклом
+const std::size_t kLLNEnsembleGroupSize = 64;
+
+// Предел буфера ошибок |mean_n - mu| окна контрольных точек (в значениях double): точки обрабатываются
+// окнами по max(1, предел / M), так что память O(M + checkpoints) при любом числе точек
+const std::size_t kLLNEnsembleWindowValues = std::size_t{1} << 22;
+
+// Квантили ошибки по ансамблю траекторий в каждой контрольной точке
+struct LLNEnsembleResult {
+  std::size_t paths = 0;
+  std::vector<std::size_t> n; // контрольные точки
+  std::vector<double> quantile_levels;
+
+  // abs_error_quantiles[j][k] - квантиль уровня quantile_levels[j] величины |mean_n - mu| по путям при n = n[k]
+  std::vector<std::vector<double>> abs_error_quantiles;
+
+  // Наклон МНК-прямой log(медиана |mean_n - mu|) от log n: для конечной дисперсии около -1/2
+  double convergence_exponent = 0.0;
+};
+
+// M независимых траекторий LLN на пуле потоков. Состояние - бегущие суммы путей в виде структуры
+// массивов (сумма и компенсация Кэхэна); результат не зависит от числа потоков
+class LLNEnsemble {
+public:
+  LLNEnsemble(std::shared_ptr<Distribution> dist, std::size_t paths);
+
+  // Контрольные точки n = step, 2 step, ..., не больше max_n
+  [[nodiscard]] LLNEnsembleResult Run(std::uint64_t seed,
+                                      std::size_t max_n,
+                                      std::size_t step,
+                                      std::size_t threads = 0,
+                                      std::span<const double> quantile_levels = kLLNEnsembleQuantileLevels) const;
+
+  // Контрольные точки по расписанию не больше max_n; с логарифмическим расписанием наклон
+  // convergence_exponent оценивается по всем масштабам n равномерно
+  [[nodiscard]] LLNEnsembleResult Run(std::uint64_t seed,
+                                      std::size_t max_n,
+                                      const CheckpointSchedule& schedule,
+                                      std::size_t threads = 0,
+                                      std::span<const double> quantile_levels = kLLNEnsembleQuantileLevels) const;
+
+private:
+  std::shared_ptr<Distribution> dist_;
+  std::size_t paths_;
+};
+
+} // namespace ptm
+
+#endif // PTM_LLNENSEMBLE_HPP_
@@ -0,0 +1,23 @@
+#ifndef PTM_LLNOPTIONS_HPP_
+#define PTM_LLNOPTIONS_HPP_
+
+namespace ptm {
+
+// Настройки моделирования траектории LLN
+struct LLNOptions {
+  // Переход между контрольными точками одним сэмплом суммы (SampleSum) вместо step отдельных сэмплов:
+  // O(max_n / step) вместо O(max_n). Точки траектории распределены так же, но поток случайных чисел другой.
+  // Для распределений без замкнутой формы суммы (Uniform, Laplace) игнорируется
+  bool jump_ahead = false;
+
+  // Заполнять LLNPathEntry::running_median (P2Quantile) и, при trim_fraction > 0, LLNPathEntry::trimmed_mean
+  // (StreamingTrimmedMean с отсечением trim_fraction с каждой стороны). Обе оценки стоят O(1) на сэмпл и
+  // требуют отдельных сэмплов, поэтому несовместимы с jump_ahead для распределений с SampleSum
+  // (для Uniform и Laplace jump_ahead и так игнорируется, и сочетание допустимо)
+  bool track_median = false;
+  double trim_fraction = 0.0;
+};
+
+} // namespace ptm
+
+#endif // PTM_LLNOPTIONS_HPP_
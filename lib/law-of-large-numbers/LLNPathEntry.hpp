@@ -1,6 +1,8 @@
 #ifndef PTM_LLNPATHENTRY_HPP_
 #define PTM_LLNPATHENTRY_HPP_
 
+#include <optional>
+
 namespace ptm {
 
 // Результат одной траектории для закона больших чисел
@@ -8,6 +10,11 @@ struct LLNPathEntry {
   size_t n;           // число сэмплов
   double sample_mean; // выборочное среднее
   double abs_error;   // |sample_mean - theoretical_mean|
+
+  // Устойчивые к тяжёлым хвостам оценки положения (LLNOptions::track_median, trim_fraction);
+  // у Коши выборочное среднее не сходится, а они сходятся к центру
+  std::optional<double> running_median; // P^2-оценка медианы
+  std::optional<double> trimmed_mean;   // потоковое усечённое среднее
 };
 
 } // namespace ptm
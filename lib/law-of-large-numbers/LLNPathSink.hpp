@@ -0,0 +1,15 @@
+#ifndef PTM_LLNPATHSINK_HPP_
+#define PTM_LLNPATHSINK_HPP_
+
+#include <functional>
+
+#include "LLNPathEntry.hpp"
+
+namespace ptm {
+
+// Получатель точек траектории: вызывается по мере их появления, поэтому траектория не хранится целиком
+using LLNPathSink = std::function<void(const LLNPathEntry&)>;
+
+} // namespace ptm
+
+#endif // PTM_LLNPATHSINK_HPP_
@@ -1,34 +1,102 @@
 #include "LawOfLargeNumbersSimulator.hpp"
+#include "LawOfLargeNumbersSimulatorT.hpp"
+#include "distributions/AnyDistribution.hpp"
 
 namespace ptm {
 
 LawOfLargeNumbersSimulator::LawOfLargeNumbersSimulator(std::shared_ptr<Distribution> dist) : dist_(std::move(dist)) {
 }
 
-LLNPathResult LawOfLargeNumbersSimulator::Simulate(std::mt19937& rng, std::size_t max_n, std::size_t step) const {
-  std::vector<double> values;
-  LLNPathResult result;
-  double sum = 0;
+template <RandomEngine Engine>
+LLNPathResult LawOfLargeNumbersSimulator::Simulate(Engine& rng,
+                                                   std::size_t max_n,
+                                                   std::size_t step,
+                                                   const LLNOptions& options) const {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return LawOfLargeNumbersSimulatorT<D>(std::move(dist)).Simulate(rng, max_n, step, options);
+  });
+}
 
-  for (std::size_t i = 1; i <= max_n; ++i) {
-    values.push_back(dist_->Sample(rng));
-    sum += values.back();
+template <RandomEngine Engine>
+void LawOfLargeNumbersSimulator::Simulate(Engine& rng,
+                                          std::size_t max_n,
+                                          std::size_t step,
+                                          const LLNPathSink& sink,
+                                          const LLNOptions& options) const {
+  VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    LawOfLargeNumbersSimulatorT<D>(std::move(dist)).Simulate(rng, max_n, step, sink, options);
+  });
+}
 
-    if (i % step == 0) {
-      LLNPathEntry entry{};
-      entry.n = i;
-      entry.sample_mean = sum / static_cast<double>(i);
-      entry.abs_error = std::abs(entry.sample_mean - dist_->TheoreticalMean());
+template <RandomEngine Engine>
+LLNPathResult LawOfLargeNumbersSimulator::Simulate(Engine& rng,
+                                                   std::size_t max_n,
+                                                   const CheckpointSchedule& schedule,
+                                                   const LLNOptions& options) const {
+  return VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    return LawOfLargeNumbersSimulatorT<D>(std::move(dist)).Simulate(rng, max_n, schedule, options);
+  });
+}
 
-      result.entries.push_back(entry);
-    }
-  }
+template <RandomEngine Engine>
+void LawOfLargeNumbersSimulator::Simulate(Engine& rng,
+                                          std::size_t max_n,
+                                          const CheckpointSchedule& schedule,
+                                          const LLNPathSink& sink,
+                                          const LLNOptions& options) const {
+  VisitDistribution(dist_, [&]<class D>(std::shared_ptr<const D> dist) {
+    LawOfLargeNumbersSimulatorT<D>(std::move(dist)).Simulate(rng, max_n, schedule, sink, options);
+  });
+}
 
-  return result;
+bool LawOfLargeNumbersSimulator::SupportsJumpAhead() const {
+  return VisitDistribution(dist_, []<class D>(const std::shared_ptr<const D>&) {
+    return LawOfLargeNumbersSimulatorT<D>::SupportsJumpAhead();
+  });
 }
 
 std::shared_ptr<Distribution> LawOfLargeNumbersSimulator::GetDistribution() const noexcept {
   return dist_;
 }
 
+template LLNPathResult LawOfLargeNumbersSimulator::Simulate(std::mt19937& rng,
+                                                           std::size_t max_n,
+                                                           std::size_t step,
+                                                           const LLNOptions& options) const;
+template LLNPathResult LawOfLargeNumbersSimulator::Simulate(Philox4x32& rng,
+                                                           std::size_t max_n,
+                                                           std::size_t step,
+                                                           const LLNOptions& options) const;
+
+template void LawOfLargeNumbersSimulator::Simulate(std::mt19937& rng,
+                                                  std::size_t max_n,
+                                                  std::size_t step,
+                                                  const LLNPathSink& sink,
+                                                  const LLNOptions& options) const;
+template void LawOfLargeNumbersSimulator::Simulate(Philox4x32& rng,
+                                                  std::size_t max_n,
+                                                  std::size_t step,
+                                                  const LLNPathSink& sink,
+                                                  const LLNOptions& options) const;
+
+template LLNPathResult LawOfLargeNumbersSimulator::Simulate(std::mt19937& rng,
+                                                           std::size_t max_n,
+                                                           const CheckpointSchedule& schedule,
+                                                           const LLNOptions& options) const;
+template LLNPathResult LawOfLargeNumbersSimulator::Simulate(Philox4x32& rng,
+                                                           std::size_t max_n,
+                                                           const CheckpointSchedule& schedule,
+                                                           const LLNOptions& options) const;
+
+template void LawOfLargeNumbersSimulator::Simulate(std::mt19937& rng,
+                                                  std::size_t max_n,
+                                                  const CheckpointSchedule& schedule,
+                                                  const LLNPathSink& sink,
+                                                  const LLNOptions& options) const;
+template void LawOfLargeNumbersSimulator::Simulate(Philox4x32& rng,
+                                                  std::size_t max_n,
+                                                  const CheckpointSchedule& schedule,
+                                                  const LLNPathSink& sink,
+                                                  const LLNOptions& options) const;
+
 } // namespace ptm
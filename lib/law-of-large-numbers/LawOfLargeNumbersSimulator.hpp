@@ -4,7 +4,10 @@
 #include <memory>
 #include <random>
 
+#include "CheckpointSchedule.hpp"
+#include "LLNOptions.hpp"
 #include "LLNPathResult.hpp"
+#include "LLNPathSink.hpp"
 #include "distributions/Distribution.hpp"
 
 namespace ptm {
@@ -21,9 +24,42 @@ public:
   //
   // Алгоритм:
   // 1) генерируем X_1, ..., X_max_n
-  // 2) считаем префиксные суммы и выборочные средние
+  // 2) считаем префиксные суммы (с компенсацией) и выборочные средние
   // 3) для n кратных step сохраняем (n, mean_n, |mean_n - mu|)
-  LLNPathResult Simulate(std::mt19937& rng, std::size_t max_n, std::size_t step) const;
+  //
+  // С options.jump_ahead шаги 1-2 для Bernoulli, Binomial, Poisson, Exponential, Geometric, Normal и Cauchy
+  // заменяются одним сэмплом суммы step значений на каждый отрезок между точками (см. SampleSum).
+  // С options.track_median и options.trim_fraction точки дополняются медианой и усечённым средним,
+  // которые сходятся и там, где среднего нет (Коши)
+  template <RandomEngine Engine>
+  LLNPathResult Simulate(Engine& rng, std::size_t max_n, std::size_t step, const LLNOptions& options = {}) const;
+
+  // То же без хранения траектории: O(1) памяти, каждая точка сразу передаётся в sink.
+  // Сумма копится с компенсацией (CompensatedSum), поэтому годится и для 10^11 сэмплов
+  template <RandomEngine Engine>
+  void Simulate(Engine& rng,
+                std::size_t max_n,
+                std::size_t step,
+                const LLNPathSink& sink,
+                const LLNOptions& options = {}) const;
+
+  // Траектория с произвольным расписанием контрольных точек (логарифмическим, явным, смешанным):
+  // число записей определяется расписанием, а не max_n / step
+  template <RandomEngine Engine>
+  LLNPathResult Simulate(Engine& rng,
+                         std::size_t max_n,
+                         const CheckpointSchedule& schedule,
+                         const LLNOptions& options = {}) const;
+
+  template <RandomEngine Engine>
+  void Simulate(Engine& rng,
+                std::size_t max_n,
+                const CheckpointSchedule& schedule,
+                const LLNPathSink& sink,
+                const LLNOptions& options = {}) const;
+
+  // Поддерживает ли распределение options.jump_ahead
+  [[nodiscard]] bool SupportsJumpAhead() const;
 
   // Доступ к распределению
   [[nodiscard]] std::shared_ptr<Distribution> GetDistribution() const noexcept;
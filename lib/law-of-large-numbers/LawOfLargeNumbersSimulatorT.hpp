@@ -0,0 +1,194 @@
+#ifndef PTM_LAWOFLARGENUMBERSSIMULATORT_HPP_
+#define PTM_LAWOFLARGENUMBERSSIMULATORT_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "CheckpointSchedule.hpp"
+#include "CompensatedSum.hpp"
+#include "LLNOptions.hpp"
+#include "LLNPathResult.hpp"
+#include "LLNPathSink.hpp"
+#include "P2Quantile.hpp"
+#include "StreamingTrimmedMean.hpp"
+#include "SumSampler.hpp"
+#include "distributions/Distribution.hpp"
+
+namespace ptm {
+
+// Траектория LLN для распределения известного на этапе компиляции типа D (см. DistributionExperimentT)
+template <class D>
+  requires std::derived_from<D, Distribution>
+class LawOfLargeNumbersSimulatorT {
+public:
+  explicit LawOfLargeNumbersSimulatorT(std::shared_ptr<const D> dist);
+
+  // Доступен ли options.jump_ahead: у суммы сэмплов D есть распределение из SampleSum
+  static constexpr bool SupportsJumpAhead() noexcept {
+    return kHasSumDistribution<D>;
+  }
+
+  template <RandomEngine Engine>
+  LLNPathResult Simulate(Engine& rng, std::size_t max_n, std::size_t step, const LLNOptions& options = {}) const;
+
+  // Потоковая траектория: O(1) памяти, точки (n кратно step) сразу отдаются в sink
+  template <RandomEngine Engine>
+  void Simulate(Engine& rng,
+                std::size_t max_n,
+                std::size_t step,
+                const LLNPathSink& sink,
+                const LLNOptions& options = {}) const;
+
+  // То же с произвольным расписанием контрольных точек
+  template <RandomEngine Engine>
+  LLNPathResult Simulate(Engine& rng,
+                         std::size_t max_n,
+                         const CheckpointSchedule& schedule,
+                         const LLNOptions& options = {}) const;
+
+  template <RandomEngine Engine>
+  void Simulate(Engine& rng,
+                std::size_t max_n,
+                const CheckpointSchedule& schedule,
+                const LLNPathSink& sink,
+                const LLNOptions& options = {}) const;
+
+private:
+  std::shared_ptr<const D> dist_;
+};
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+LawOfLargeNumbersSimulatorT<D>::LawOfLargeNumbersSimulatorT(std::shared_ptr<const D> dist) : dist_(std::move(dist)) {
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+LLNPathResult LawOfLargeNumbersSimulatorT<D>::Simulate(Engine& rng,
+                                                       std::size_t max_n,
+                                                       std::size_t step,
+                                                       const LLNOptions& options) const {
+  return Simulate(rng, max_n, CheckpointSchedule::Linear(step), options);
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+void LawOfLargeNumbersSimulatorT<D>::Simulate(Engine& rng,
+                                              std::size_t max_n,
+                                              std::size_t step,
+                                              const LLNPathSink& sink,
+                                              const LLNOptions& options) const {
+  Simulate(rng, max_n, CheckpointSchedule::Linear(step), sink, options);
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+LLNPathResult LawOfLargeNumbersSimulatorT<D>::Simulate(Engine& rng,
+                                                       std::size_t max_n,
+                                                       const CheckpointSchedule& schedule,
+                                                       const LLNOptions& options) const {
+  LLNPathResult result;
+  Simulate(rng, max_n, schedule, [&result](const LLNPathEntry& entry) { result.entries.push_back(entry); }, options);
+
+  return result;
+}
+
+template <class D>
+  requires std::derived_from<D, Distribution>
+template <RandomEngine Engine>
+void LawOfLargeNumbersSimulatorT<D>::Simulate(Engine& rng,
+                                              std::size_t max_n,
+                                              const CheckpointSchedule& schedule,
+                                              const LLNPathSink& sink,
+                                              const LLNOptions& options) const {
+  const bool robust = options.track_median || options.trim_fraction > 0;
+
+  // Для распределений без SampleSum jump_ahead игнорируется, и робастные оценки считаются по обычной траектории
+  if (robust && options.jump_ahead && SupportsJumpAhead())
+    throw std::invalid_argument("Running median and trimmed mean need individual samples, not jump-ahead");
+
+  const double theoretical_mean = dist_->TheoreticalMean();
+  CompensatedSum sum;
+  std::optional<P2Quantile> median;
+  std::optional<StreamingTrimmedMean> trimmed;
+
+  if (options.track_median)
+    median.emplace(0.5);
+
+  if (options.trim_fraction > 0)
+    trimmed.emplace(options.trim_fraction);
+
+  auto emit = [&](std::size_t n) {
+    LLNPathEntry entry{};
+    entry.n = n;
+    entry.sample_mean = sum.Value() / static_cast<double>(n);
+    entry.abs_error = std::abs(entry.sample_mean - theoretical_mean);
+
+    if (median)
+      entry.running_median = median->Value();
+
+    if (trimmed)
+      entry.trimmed_mean = trimmed->Value();
+
+    sink(entry);
+  };
+
+  if constexpr (SupportsJumpAhead()) {
+    if (options.jump_ahead) {
+      for (std::size_t n = 0, next = schedule.Next(0); next <= max_n; n = next, next = schedule.Next(n)) {
+        sum.Add(SampleSum(*dist_, rng, next - n));
+        emit(next);
+      }
+
+      return;
+    }
+  }
+
+  std::vector<double> block(std::min(kSampleBatchSize, max_n));
+  std::size_t i = 0;
+  std::size_t next_checkpoint = schedule.Next(0);
+
+  // После последней точки сэмплы не нужны
+  while (next_checkpoint <= max_n) {
+    std::span<double> chunk(block.data(), std::min(block.size(), max_n - i));
+    dist_->SampleBatch(rng, chunk);
+
+    // Блок режется по контрольным точкам, отрезки между ними суммируются целиком
+    for (std::size_t position = 0; position < chunk.size() && next_checkpoint <= max_n;) {
+      const std::size_t count = std::min(chunk.size() - position, next_checkpoint - i);
+      const std::span<const double> segment = chunk.subspan(position, count);
+      sum.AddBatch(segment);
+
+      // Поэлементные оценки - только если запрошены, основной цикл остаётся блочным
+      if (robust) {
+        for (double value : segment) {
+          if (median)
+            median->Add(value);
+
+          if (trimmed)
+            trimmed->Add(value);
+        }
+      }
+      position += count;
+      i += count;
+
+      if (i == next_checkpoint) {
+        emit(i);
+        next_checkpoint = schedule.Next(i);
+      }
+    }
+  }
+}
+
+} // namespace ptm
+
+#endif // PTM_LAWOFLARGENUMBERSSIMULATORT_HPP_
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "P2Quantile.hpp"
+
+namespace ptm {
+
+P2Quantile::P2Quantile(double p) : p_(p) {
+  if (!(p > 0 && p < 1))
+    throw std::invalid_argument("P2 quantile level must lie in (0, 1)");
+
+  // Уровни маркеров: равномерно по [0, p] слева от середины и по [p, 1] справа
+  const std::size_t middle = kP2Markers / 2;
+
+  for (std::size_t i = 0; i < kP2Markers; ++i) {
+    const double step = static_cast<double>(i <= middle ? i : i - middle) / static_cast<double>(middle);
+    increments_[i] = i <= middle ? p * step : p + (1 - p) * step;
+    positions_[i] = static_cast<double>(i);
+    desired_[i] = static_cast<double>(kP2Markers - 1) * increments_[i];
+  }
+}
+
+void P2Quantile::Add(double value) {
+  if (count_ < heights_.size()) {
+    heights_[count_++] = value;
+
+    if (count_ == heights_.size())
+      std::sort(heights_.begin(), heights_.end());
+
+    return;
+  }
+
+  ++count_;
+
+  // Ячейка k между маркерами k и k + 1; крайние маркеры - минимум и максимум
+  const std::size_t last = kP2Markers - 1;
+  std::size_t k = 0;
+
+  if (value < heights_[0]) {
+    heights_[0] = value;
+  } else if (value >= heights_[last]) {
+    heights_[last] = value;
+    k = last - 1;
+  } else {
+    while (value >= heights_[k + 1]) {
+      ++k;
+    }
+  }
+
+  for (std::size_t i = k + 1; i < positions_.size(); ++i) {
+    positions_[i] += 1;
+  }
+
+  for (std::size_t i = 0; i < desired_.size(); ++i) {
+    desired_[i] += increments_[i];
+  }
+
+  // Внутренние маркеры, отставшие от желаемой позиции больше чем на 1, сдвигаются на одну позицию
+  for (std::size_t i = 1; i < last; ++i) {
+    const double delta = desired_[i] - positions_[i];
+
+    if ((delta >= 1 && positions_[i + 1] - positions_[i] > 1) ||
+        (delta <= -1 && positions_[i - 1] - positions_[i] < -1)) {
+      const double direction = delta > 0 ? 1 : -1;
+      const double candidate = Parabolic(i, direction);
+
+      if (heights_[i - 1] < candidate && candidate < heights_[i + 1])
+        heights_[i] = candidate;
+      else
+        heights_[i] = Linear(i, direction);
+
+      positions_[i] += direction;
+    }
+  }
+}
+
+double P2Quantile::Value() const {
+  if (count_ == 0)
+    return std::numeric_limits<double>::quiet_NaN();
+
+  if (count_ >= heights_.size())
+    return heights_[kP2Markers / 2];
+
+  std::array<double, kP2Markers> sorted = heights_;
+  std::sort(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(count_));
+
+  return sorted[static_cast<std::size_t>(std::round(p_ * static_cast<double>(count_ - 1)))];
+}
+
+std::size_t P2Quantile::Count() const noexcept {
+  return count_;
+}
+
+double P2Quantile::Parabolic(std::size_t i, double direction) const {
+  const double below = positions_[i] - positions_[i - 1];
+  const double above = positions_[i + 1] - positions_[i];
+
+  return heights_[i] + direction / (positions_[i + 1] - positions_[i - 1]) *
+                           ((below + direction) * (heights_[i + 1] - heights_[i]) / above +
+                            (above - direction) * (heights_[i] - heights_[i - 1]) / below);
+}
+
+double P2Quantile::Linear(std::size_t i, double direction) const {
+  const std::size_t neighbour = direction > 0 ? i + 1 : i - 1;
+
+  return heights_[i] + direction * (heights_[neighbour] - heights_[i]) / (positions_[neighbour] - positions_[i]);
+}
+
+} // namespace ptm
@@ -0,0 +1,42 @@
+#include <limits>
+#include <stdexcept>
+
+#include "StreamingTrimmedMean.hpp"
+
+namespace ptm {
+
+namespace {
+
+double CheckTrim(double trim) {
+  if (!(trim > 0 && trim < 0.5))
+    throw std::invalid_argument("Trim fraction must lie in (0, 1/2)");
+
+  return trim;
+}
+
+} // namespace
+
+StreamingTrimmedMean::StreamingTrimmedMean(double trim) : lower_(CheckTrim(trim)), upper_(1 - trim) {
+}
+
+void StreamingTrimmedMean::Add(double value) {
+  // До появления оценок квантилей принимается всё
+  const bool inside = lower_.Count() == 0 || (value >= lower_.Value() && value <= upper_.Value());
+
+  if (inside) {
+    sum_.Add(value);
+    ++kept_;
+  }
+
+  lower_.Add(value);
+  upper_.Add(value);
+}
+
+double StreamingTrimmedMean::Value() const {
+  if (kept_ == 0)
+    return std::numeric_limits<double>::quiet_NaN();
+
+  return sum_.Value() / static_cast<double>(kept_);
+}
+
+} // namespace ptm
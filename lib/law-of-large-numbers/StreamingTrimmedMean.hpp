@@ -0,0 +1,33 @@
+#ifndef PTM_STREAMINGTRIMMEDMEAN_HPP_
+#define PTM_STREAMINGTRIMMEDMEAN_HPP_
+
+#include <cstddef>
+
+#include "CompensatedSum.hpp"
+#include "P2Quantile.hpp"
+
+namespace ptm {
+
+// Потоковое усечённое среднее: среднее значений между квантилями trim и 1 - trim. Границы - текущие
+// P^2-оценки этих квантилей на момент прихода значения, поэтому память O(1); пока оценки не
+// установились (первые значения), среднее слегка смещено, но смещение исчезает с ростом n
+class StreamingTrimmedMean {
+public:
+  // 0 < trim < 1/2
+  explicit StreamingTrimmedMean(double trim);
+
+  void Add(double value);
+
+  // NaN, пока не принято ни одного значения
+  [[nodiscard]] double Value() const;
+
+private:
+  P2Quantile lower_;
+  P2Quantile upper_;
+  CompensatedSum sum_;
+  std::size_t kept_ = 0;
+};
+
+} // namespace ptm
+
+#endif // PTM_STREAMINGTRIMMEDMEAN_HPP_
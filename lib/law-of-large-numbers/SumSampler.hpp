@@ -0,0 +1,59 @@
+#ifndef PTM_SUMSAMPLER_HPP_
+#define PTM_SUMSAMPLER_HPP_
+
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <random>
+
+#include "distributions/BernoulliDistribution.hpp"
+#include "distributions/BinomialDistribution.hpp"
+#include "distributions/CauchyDistribution.hpp"
+#include "distributions/ExponentialDistribution.hpp"
+#include "distributions/GeometricDistribution.hpp"
+#include "distributions/NormalDistribution.hpp"
+#include "distributions/PoissonDistribution.hpp"
+
+namespace ptm {
+
+// Есть ли у суммы независимых сэмплов D распределение, из которого можно выбирать напрямую
+template <class D>
+constexpr bool kHasSumDistribution =
+    std::same_as<D, BernoulliDistribution> || std::same_as<D, BinomialDistribution> ||
+    std::same_as<D, CauchyDistribution> || std::same_as<D, ExponentialDistribution> ||
+    std::same_as<D, GeometricDistribution> || std::same_as<D, NormalDistribution> ||
+    std::same_as<D, PoissonDistribution>;
+
+// Сумма count независимых сэмплов dist одним розыгрышем (точно по распределению, не приближение):
+// Bernoulli(p) -> Binomial(count, p), Binomial(n, p) -> Binomial(count n, p), Poisson(l) -> Poisson(count l),
+// Exp(l) -> Gamma(count, 1 / l), Geometric(p) -> count + NegativeBinomial(count, p),
+// N(mu, sigma) -> N(count mu, sqrt(count) sigma), Cauchy(x0, g) -> Cauchy(count x0, count g).
+// Целочисленные суммы - в std::int64_t, параметры Binomial и Poisson не ограничены 32 битами
+template <class D, RandomEngine Engine>
+  requires kHasSumDistribution<D>
+double SampleSum(const D& dist, Engine& rng, std::uint64_t count) {
+  const auto n = static_cast<double>(count);
+
+  if constexpr (std::same_as<D, BernoulliDistribution>) {
+    return static_cast<double>(std::binomial_distribution<std::int64_t>(count, dist.GetP())(rng));
+  } else if constexpr (std::same_as<D, BinomialDistribution>) {
+    const auto trials = static_cast<std::int64_t>(count * dist.GetN());
+
+    return static_cast<double>(std::binomial_distribution<std::int64_t>(trials, dist.GetP())(rng));
+  } else if constexpr (std::same_as<D, CauchyDistribution>) {
+    return CauchyDistribution(n * dist.GetX0(), n * dist.GetGamma()).Sample(rng);
+  } else if constexpr (std::same_as<D, ExponentialDistribution>) {
+    return std::gamma_distribution<double>(n, 1 / dist.GetLambda())(rng);
+  } else if constexpr (std::same_as<D, GeometricDistribution>) {
+    // std::negative_binomial_distribution считает неудачи до count-го успеха, носитель Geometric - {1, 2, ...}
+    return n + static_cast<double>(std::negative_binomial_distribution<std::int64_t>(count, dist.GetP())(rng));
+  } else if constexpr (std::same_as<D, NormalDistribution>) {
+    return NormalDistribution(n * dist.GetMean(), std::sqrt(n) * dist.GetStddev()).Sample(rng);
+  } else {
+    return static_cast<double>(std::poisson_distribution<std::int64_t>(n * dist.GetLambda())(rng));
+  }
+}
+
+} // namespace ptm
+
+#endif // PTM_SUMSAMPLER_HPP_
@@ -46,7 +46,8 @@ double MarkovChain::TransitionProbability(const State& from, const State& to) co
   return static_cast<double>(counts(fromI, toI)) / static_cast<double>(row_sums_[fromI]);
 }
 
-std::optional<MarkovChain::State> MarkovChain::SampleNext(const State& current, std::mt19937& rng) const {
+template <RandomEngine Engine>
+std::optional<MarkovChain::State> MarkovChain::SampleNext(const State& current, Engine& rng) const {
   double r = static_cast<double>(rng() - rng.min()) / static_cast<double>(rng.max() - rng.min());
   auto distribution = NextDistribution(current);
 
@@ -60,7 +61,8 @@ std::optional<MarkovChain::State> MarkovChain::SampleNext(const State& current,
   }
 }
 
-std::vector<MarkovChain::State> MarkovChain::Generate(const State& start, size_t length, std::mt19937& rng) const {
+template <RandomEngine Engine>
+std::vector<MarkovChain::State> MarkovChain::Generate(const State& start, size_t length, Engine& rng) const {
   std::vector<MarkovChain::State> ans;
   ans.reserve(length);
 
@@ -84,4 +86,14 @@ bool MarkovChain::HasState(const State& state) const {
   return state_to_index_.contains(state);
 }
 
+template std::optional<MarkovChain::State> MarkovChain::SampleNext(const State& current, std::mt19937& rng) const;
+template std::optional<MarkovChain::State> MarkovChain::SampleNext(const State& current, Philox4x32& rng) const;
+
+template std::vector<MarkovChain::State> MarkovChain::Generate(const State& start,
+                                                               size_t length,
+                                                               std::mt19937& rng) const;
+template std::vector<MarkovChain::State> MarkovChain::Generate(const State& start,
+                                                               size_t length,
+                                                               Philox4x32& rng) const;
+
 } // namespace ptm
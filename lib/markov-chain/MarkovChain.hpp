@@ -8,6 +8,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "random/RandomEngine.hpp"
+
 namespace ptm {
 
 class MarkovChain {
@@ -27,10 +29,12 @@ public:
 
   // Сгенерировать следующий токен из распределения P(next | current)
   // Если у current нет исходящих переходов, возвращает std::nullopt
-  std::optional<State> SampleNext(const State& current, std::mt19937& rng) const;
+  template <RandomEngine Engine>
+  std::optional<State> SampleNext(const State& current, Engine& rng) const;
 
   // Сгенерировать последовательность длины length, начиная с start
-  std::vector<State> Generate(const State& start, size_t length, std::mt19937& rng) const;
+  template <RandomEngine Engine>
+  std::vector<State> Generate(const State& start, size_t length, Engine& rng) const;
 
   // Все известные состояния
   std::vector<State> States() const;
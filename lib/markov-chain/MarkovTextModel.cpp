@@ -12,8 +12,9 @@ void MarkovTextModel::TrainFromText(const std::string& text) {
   chain_.Train(Tokenize(text));
 }
 
+template <RandomEngine Engine>
 std::string MarkovTextModel::GenerateText(std::size_t num_tokens,
-                                          std::mt19937& rng,
+                                          Engine& rng,
                                           const std::string& start_token) const {
   std::string start = start_token;
   if (!chain_.HasState(start))
@@ -65,4 +66,11 @@ std::string MarkovTextModel::Detokenize(const std::vector<std::string>& tokens)
   }
 }
 
+template std::string MarkovTextModel::GenerateText(std::size_t num_tokens,
+                                                   std::mt19937& rng,
+                                                   const std::string& start_token) const;
+template std::string MarkovTextModel::GenerateText(std::size_t num_tokens,
+                                                   Philox4x32& rng,
+                                                   const std::string& start_token) const;
+
 } // namespace ptm
@@ -21,7 +21,8 @@ public:
   // - num_tokens: количество токенов (символов или слов в зависимости от уровня)
   // - start_token: опциональный стартовый токен; если не задан или не встречался,
   //   берётся первый известный токен модели
-  std::string GenerateText(std::size_t num_tokens, std::mt19937& rng, const std::string& start_token = "") const;
+  template <RandomEngine Engine>
+  std::string GenerateText(std::size_t num_tokens, Engine& rng, const std::string& start_token = "") const;
 
   const MarkovChain& Chain() const noexcept;
 
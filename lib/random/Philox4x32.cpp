@@ -0,0 +1,83 @@
+#include "Philox4x32.hpp"
+
+namespace ptm {
+
+namespace {
+
+const std::uint32_t kPhiloxMultiplier0 = 0xD2511F53;
+const std::uint32_t kPhiloxMultiplier1 = 0xCD9E8D57;
+const std::uint32_t kPhiloxWeyl0 = 0x9E3779B9;
+const std::uint32_t kPhiloxWeyl1 = 0xBB67AE85;
+const int kPhiloxRounds = 10;
+
+const std::uint64_t kWordsPerBlock = 4;
+
+std::uint32_t Low(std::uint64_t value) {
+  return static_cast<std::uint32_t>(value);
+}
+
+std::uint32_t High(std::uint64_t value) {
+  return static_cast<std::uint32_t>(value >> 32);
+}
+
+} // namespace
+
+Philox4x32::Philox4x32(std::uint64_t seed, std::uint64_t stream) : seed_(seed), stream_(stream) {
+}
+
+Philox4x32::result_type Philox4x32::operator()() {
+  const std::uint64_t block = position_ / kWordsPerBlock;
+
+  if (block != buffered_block_) {
+    buffer_ = Block({Low(block), High(block), Low(stream_), High(stream_)}, {Low(seed_), High(seed_)});
+    buffered_block_ = block;
+  }
+
+  return buffer_[position_++ % kWordsPerBlock];
+}
+
+void Philox4x32::seed(std::uint64_t seed, std::uint64_t stream) {
+  *this = Philox4x32(seed, stream);
+}
+
+void Philox4x32::discard(std::uint64_t z) {
+  position_ += z;
+}
+
+std::uint64_t Philox4x32::Seed() const noexcept {
+  return seed_;
+}
+
+std::uint64_t Philox4x32::Stream() const noexcept {
+  return stream_;
+}
+
+std::uint64_t Philox4x32::Position() const noexcept {
+  return position_;
+}
+
+std::array<std::uint32_t, 4> Philox4x32::Block(std::array<std::uint32_t, 4> counter,
+                                               std::array<std::uint32_t, 2> key) {
+  for (int round = 0; round < kPhiloxRounds; ++round) {
+    const std::uint64_t product0 = static_cast<std::uint64_t>(kPhiloxMultiplier0) * counter[0];
+    const std::uint64_t product1 = static_cast<std::uint64_t>(kPhiloxMultiplier1) * counter[2];
+
+    counter = {
+        High(product1) ^ counter[1] ^ key[0],
+        Low(product1),
+        High(product0) ^ counter[3] ^ key[1],
+        Low(product0),
+    };
+
+    key[0] += kPhiloxWeyl0;
+    key[1] += kPhiloxWeyl1;
+  }
+
+  return counter;
+}
+
+bool operator==(const Philox4x32& lhs, const Philox4x32& rhs) noexcept {
+  return lhs.seed_ == rhs.seed_ && lhs.stream_ == rhs.stream_ && lhs.position_ == rhs.position_;
+}
+
+} // namespace ptm
@@ -0,0 +1,18 @@
+#ifndef PTM_RANDOMENGINE_HPP_
+#define PTM_RANDOMENGINE_HPP_
+
+#include <concepts>
+#include <random>
+
+#include "Philox4x32.hpp"
+
+namespace ptm {
+
+// Генераторы, которые принимает библиотека. Distribution - виртуальный интерфейс,
+// поэтому для каждого генератора из списка у него есть своя перегрузка Sample/SampleBatch.
+template <class Engine>
+concept RandomEngine = std::same_as<Engine, std::mt19937> || std::same_as<Engine, Philox4x32>;
+
+} // namespace ptm
+
+#endif // PTM_RANDOMENGINE_HPP_
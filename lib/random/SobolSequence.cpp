@@ -0,0 +1,59 @@
+#include "SobolSequence.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Множители перестановки Laine-Karras в варианте Burley
+const std::uint32_t kLaineKarras0 = 0x6c50b47cu;
+const std::uint32_t kLaineKarras1 = 0xb82f1e52u;
+const std::uint32_t kLaineKarras2 = 0xc7afe638u;
+const std::uint32_t kLaineKarras3 = 0x8d22f6e6u;
+
+// Середина ячейки сетки с шагом 2^-32
+const double kUnitInterval32 = 1.0 / 4294967296.0;
+
+std::uint32_t ReverseBits(std::uint32_t x) {
+  x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+  x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+  x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+  x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+
+  return (x >> 16) | (x << 16);
+}
+
+// Каждый бит результата зависит только от этого и младших битов x - в обращённом порядке
+// это вложенная перестановка Оуэна
+std::uint32_t LaineKarrasPermutation(std::uint32_t x, std::uint32_t seed) {
+  x += seed;
+  x ^= x * kLaineKarras0;
+  x ^= x * kLaineKarras1;
+  x ^= x * kLaineKarras2;
+  x ^= x * kLaineKarras3;
+
+  return x;
+}
+
+} // namespace
+
+SobolSequence::SobolSequence(std::uint32_t seed) : seed_(seed) {
+}
+
+double SobolSequence::operator[](std::uint32_t index) const {
+  // Первое измерение Соболя - reverse_bits(index); скремблирование reverse(LK(reverse(.))) сокращается
+  const std::uint32_t bits = ReverseBits(LaineKarrasPermutation(index, seed_));
+
+  return (static_cast<double>(bits) + 0.5) * kUnitInterval32;
+}
+
+void SobolSequence::Fill(std::uint32_t first, std::span<double> out) const {
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    out[i] = (*this)[first + static_cast<std::uint32_t>(i)];
+  }
+}
+
+std::uint32_t SobolSequence::Seed() const noexcept {
+  return seed_;
+}
+
+} // namespace ptm
@@ -0,0 +1,34 @@
+#ifndef PTM_SOBOLSEQUENCE_HPP_
+#define PTM_SOBOLSEQUENCE_HPP_
+
+#include <cstdint>
+#include <span>
+
+namespace ptm {
+
+// Номера точек - 32-битные: после 2^32 точек последовательность повторяется
+const std::uint64_t kSobolSequencePeriod = std::uint64_t{1} << 32;
+
+// Одномерная последовательность Соболя (ван дер Корпут по основанию 2) со скремблированием Оуэна.
+// Скремблирование - хэш Laine-Karras над обращёнными битами (Burley, 2020): любые 2^m подряд идущих
+// с начала точек по-прежнему лежат по одной в каждом отрезке [j / 2^m, (j + 1) / 2^m), а при случайном
+// seed каждая точка равномерна на (0, 1) - на этом держатся оценки погрешности рандомизированного QMC
+class SobolSequence {
+public:
+  explicit SobolSequence(std::uint32_t seed = 0);
+
+  // Точка с номером index, лежит строго внутри (0, 1)
+  [[nodiscard]] double operator[](std::uint32_t index) const;
+
+  // out[i] = точка с номером first + i
+  void Fill(std::uint32_t first, std::span<double> out) const;
+
+  [[nodiscard]] std::uint32_t Seed() const noexcept;
+
+private:
+  std::uint32_t seed_;
+};
+
+} // namespace ptm
+
+#endif // PTM_SOBOLSEQUENCE_HPP_
@@ -1,16 +1,30 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <numbers>
+#include <numeric>
 
+#include "lib/distributions/AliasTable.hpp"
+#include "lib/distributions/AnyDistribution.hpp"
 #include "lib/distributions/BernoulliDistribution.hpp"
 #include "lib/distributions/BinomialDistribution.hpp"
 #include "lib/distributions/CauchyDistribution.hpp"
 #include "lib/distributions/DistributionExperiment.hpp"
+#include "lib/distributions/DistributionExperimentT.hpp"
+#include "lib/distributions/ExponentialDistribution.hpp"
 #include "lib/distributions/GeometricDistribution.hpp"
+#include "lib/distributions/GoodnessOfFit.hpp"
+#include "lib/distributions/GridBinning.hpp"
+#include "lib/distributions/KllSketch.hpp"
 #include "lib/distributions/LaplaceDistribution.hpp"
+#include "lib/distributions/MomentAccumulator.hpp"
 #include "lib/distributions/NormalDistribution.hpp"
 #include "lib/distributions/PoissonDistribution.hpp"
+#include "lib/distributions/QuantileTable.hpp"
+#include "lib/distributions/ReplicatedExperiment.hpp"
+#include "lib/distributions/TailImportanceSampler.hpp"
 #include "lib/distributions/UniformDistribution.hpp"
 
 TEST(DistributionTest, NormalDistributionBasicProperties) {
@@ -73,6 +87,37 @@ TEST(DistributionTest, BinomialDistributionBasic) {
   EXPECT_NEAR(bd.TheoreticalVariance(), 2.5, 1e-9);
 }
 
+TEST(DistributionTest, BinomialExactCdf) {
+  using namespace ptm;
+
+  BinomialDistribution small(10, 0.5);
+  EXPECT_NEAR(small.Cdf(3.5), 0.171875, 1e-14);
+  EXPECT_NEAR(small.Cdf(-1.0), 0.0, 1e-15);
+  EXPECT_NEAR(small.Cdf(10.0), 1.0, 1e-15);
+
+  BinomialDistribution bd(1000, 0.3);
+  EXPECT_NEAR(bd.Pdf(300.0), 0.027521003821268386, 1e-15);
+  EXPECT_NEAR(bd.Cdf(280.0), 0.088579522605949924, 1e-14);
+
+  BinomialDistribution rare(200, 0.05);
+  EXPECT_NEAR(rare.Cdf(3.0), 0.0090483763961015406, 1e-15);
+
+  BinomialDistribution large(100000, 0.01);
+  EXPECT_NEAR(large.Cdf(950.0), 0.056927834566250698, 1e-13);
+
+  // По симметрии P(X <= n / 2) = 1/2 + P(X = n / 2) / 2; цепной дроби нужно ~sqrt(n) шагов
+  BinomialDistribution huge(1000000000, 0.5);
+  EXPECT_NEAR(huge.Cdf(5e8), 0.5 + huge.Pdf(5e8) / 2, 1e-9);
+
+  BinomialDistribution table(1000, 0.3);
+  table.EnableTable();
+
+  for (double k : {0.0, 150.0, 280.0, 300.0, 999.0}) {
+    EXPECT_NEAR(table.Pdf(k), bd.Pdf(k), 1e-14);
+    EXPECT_NEAR(table.Cdf(k), bd.Cdf(k), 1e-12);
+  }
+}
+
 TEST(DistributionTest, GeometricDistributionBasic) {
   using namespace ptm;
 
@@ -103,6 +148,22 @@ TEST(DistributionTest, PoissonDistributionBasic) {
   EXPECT_NEAR(cdf1, p0 + p1, 1e-6);
 }
 
+TEST(DistributionTest, PoissonLargeLambda) {
+  using namespace ptm;
+
+  PoissonDistribution small(10.0);
+  EXPECT_NEAR(small.Pdf(20.0), 0.0018660813139987742, 1e-15);
+
+  PoissonDistribution pd(1000.0);
+  EXPECT_NEAR(pd.Cdf(1000.0), 0.5084093671683851, 1e-10);
+  EXPECT_NEAR(pd.Cdf(950.5), 0.05783629295530511, 1e-10);
+  EXPECT_NEAR(pd.Cdf(1e12), 1.0, 1e-12);
+  EXPECT_NEAR(pd.Cdf(1000.0) - pd.Cdf(999.0), pd.Pdf(1000.0), 1e-12);
+
+  PoissonDistribution huge(5000.0);
+  EXPECT_NEAR(huge.Cdf(5100.0), 0.922037665463021, 1e-9);
+}
+
 TEST(DistributionTest, CauchyDistributionBasic) {
   using namespace ptm;
 
@@ -133,3 +194,648 @@ TEST(DistributionExperimentTest, BinomialEmpiricalMean) {
   EXPECT_NEAR(stats.empirical_mean, dist->TheoreticalMean(), 0.2);
   EXPECT_NEAR(stats.empirical_variance, dist->TheoreticalVariance(), 0.5);
 }
+
+TEST(DistributionTest, SampleBatchMatchesMoments) {
+  using namespace ptm;
+
+  std::mt19937 rng(42);
+  std::vector<double> values(100000);
+
+  PoissonDistribution pd(4.0);
+  pd.SampleBatch(rng, values);
+
+  double mean = std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+  EXPECT_NEAR(mean, pd.TheoreticalMean(), 0.05);
+}
+
+TEST(DistributionTest, GeometricSamplesStartFromOne) {
+  using namespace ptm;
+
+  std::mt19937 rng(42);
+  std::vector<double> values(100000);
+
+  GeometricDistribution gd(0.25);
+  gd.SampleBatch(rng, values);
+
+  EXPECT_GE(*std::min_element(values.begin(), values.end()), 1.0);
+
+  double mean = std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+  EXPECT_NEAR(mean, gd.TheoreticalMean(), 0.05);
+}
+
+TEST(DistributionExperimentTest, NormalBatchMatchesCdf) {
+  using namespace ptm;
+
+  std::mt19937 rng(2024);
+  auto dist = std::make_shared<NormalDistribution>(1.0, 3.0);
+  DistributionExperiment experiment(dist, 200000);
+
+  std::vector<double> grid;
+  for (int i = -40; i <= 40; ++i) {
+    grid.push_back(1.0 + 0.4 * i);
+  }
+
+  auto ecdf = experiment.EmpiricalCdf(grid, rng, 200000);
+  EXPECT_LT(experiment.KolmogorovDistance(grid, ecdf), 0.005);
+}
+
+TEST(DistributionExperimentTest, CauchyBatchMatchesCdf) {
+  using namespace ptm;
+
+  std::mt19937 rng(2024);
+  auto dist = std::make_shared<CauchyDistribution>(-2.0, 0.5);
+  DistributionExperiment experiment(dist, 200000);
+
+  std::vector<double> grid;
+  for (int i = -40; i <= 40; ++i) {
+    grid.push_back(-2.0 + 0.25 * i);
+  }
+
+  auto ecdf = experiment.EmpiricalCdf(grid, rng, 200000);
+  EXPECT_LT(experiment.KolmogorovDistance(grid, ecdf), 0.005);
+}
+
+TEST(DistributionExperimentTest, ExponentialBatchMatchesCdf) {
+  using namespace ptm;
+
+  std::mt19937 rng(2024);
+  auto dist = std::make_shared<ExponentialDistribution>(0.5);
+  DistributionExperiment experiment(dist, 200000);
+
+  std::vector<double> grid;
+  for (int i = 0; i <= 80; ++i) {
+    grid.push_back(0.25 * i);
+  }
+
+  auto ecdf = experiment.EmpiricalCdf(grid, rng, 200000);
+  EXPECT_LT(experiment.KolmogorovDistance(grid, ecdf), 0.005);
+}
+
+TEST(DistributionExperimentTest, LaplaceBatchMatchesCdf) {
+  using namespace ptm;
+
+  std::mt19937 rng(2024);
+  auto dist = std::make_shared<LaplaceDistribution>(3.0, 2.0);
+  DistributionExperiment experiment(dist, 200000);
+
+  std::vector<double> grid;
+  for (int i = -40; i <= 40; ++i) {
+    grid.push_back(3.0 + 0.25 * i);
+  }
+
+  auto ecdf = experiment.EmpiricalCdf(grid, rng, 200000);
+  EXPECT_LT(experiment.KolmogorovDistance(grid, ecdf), 0.005);
+}
+
+TEST(DistributionTest, BatchPdfCdfMatchScalar) {
+  using namespace ptm;
+
+  std::vector<std::shared_ptr<Distribution>> distributions = {
+      std::make_shared<NormalDistribution>(1.0, 2.0),
+      std::make_shared<UniformDistribution>(-1.0, 3.0),
+      std::make_shared<ExponentialDistribution>(1.5),
+      std::make_shared<CauchyDistribution>(0.5, 2.0),
+      std::make_shared<LaplaceDistribution>(-1.0, 0.5),
+      std::make_shared<PoissonDistribution>(3.0),
+  };
+
+  std::vector<double> grid;
+  for (int i = -400; i <= 400; ++i) {
+    grid.push_back(0.025 * i);
+  }
+
+  std::vector<double> pdf(grid.size());
+  std::vector<double> cdf(grid.size());
+
+  for (const auto& dist : distributions) {
+    dist->PdfBatch(grid, pdf);
+    dist->CdfBatch(grid, cdf);
+
+    for (std::size_t i = 0; i < grid.size(); ++i) {
+      EXPECT_NEAR(pdf[i], dist->Pdf(grid[i]), 1e-12);
+      EXPECT_NEAR(cdf[i], dist->Cdf(grid[i]), 1e-12);
+    }
+  }
+}
+
+TEST(DistributionTest, AliasTableMatchesPmf) {
+  using namespace ptm;
+
+  std::mt19937 rng(7);
+  std::vector<double> values(200000);
+
+  BinomialDistribution bd(12, 0.3);
+  bd.EnableAliasTable();
+  bd.SampleBatch(rng, values);
+
+  for (int k = 0; k <= 12; ++k) {
+    double frequency = static_cast<double>(std::count(values.begin(), values.end(), k)) / values.size();
+    EXPECT_NEAR(frequency, bd.Pdf(k), 5e-3);
+  }
+
+  PoissonDistribution pd(2.5);
+  pd.EnableAliasTable();
+  pd.SampleBatch(rng, values);
+
+  EXPECT_GE(*std::min_element(values.begin(), values.end()), 0.0);
+
+  double mean = std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+  EXPECT_NEAR(mean, pd.TheoreticalMean(), 0.02);
+
+  double zeros = static_cast<double>(std::count(values.begin(), values.end(), 0.0)) / values.size();
+  EXPECT_NEAR(zeros, std::exp(-2.5), 5e-3);
+}
+
+TEST(DistributionTest, AliasTableBuildsFromWeights) {
+  using namespace ptm;
+
+  AliasTable table({1, 0, 3}, 10);
+  EXPECT_EQ(table.Size(), 3u);
+
+  Philox4x32 rng(1);
+  std::vector<double> values(100000);
+  table.Fill(rng, values);
+
+  EXPECT_EQ(std::count(values.begin(), values.end(), 11.0), 0);
+  double frequency = static_cast<double>(std::count(values.begin(), values.end(), 12.0)) / values.size();
+  EXPECT_NEAR(frequency, 0.75, 5e-3);
+
+  EXPECT_THROW(AliasTable({}, 0), std::invalid_argument);
+  EXPECT_THROW(PoissonDistribution(1).EnableAliasTable(1), std::invalid_argument);
+}
+
+TEST(DistributionExperimentTest, StaticDispatchMatchesPolymorphic) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<LaplaceDistribution>(1.0, 2.0);
+
+  std::optional<AnyDistribution> any = ToAnyDistribution(*dist);
+  ASSERT_TRUE(any.has_value());
+  EXPECT_TRUE(std::holds_alternative<LaplaceDistribution>(*any));
+
+  Philox4x32 rng_static(5);
+  Philox4x32 rng_polymorphic(5);
+
+  DistributionExperimentT<LaplaceDistribution> typed(dist, 10000);
+  DistributionExperiment experiment(dist, 10000);
+
+  ExperimentStats typed_stats = typed.Run(rng_static);
+  ExperimentStats stats = experiment.Run(rng_polymorphic);
+
+  EXPECT_EQ(typed_stats.empirical_mean, stats.empirical_mean);
+  EXPECT_EQ(typed_stats.empirical_variance, stats.empirical_variance);
+}
+
+TEST(DistributionTest, QuantileInvertsCdf) {
+  using namespace ptm;
+
+  NormalDistribution standard(0.0, 1.0);
+  EXPECT_NEAR(standard.Quantile(1e-300), -37.0470962993612, 1e-12);
+  EXPECT_NEAR(standard.Quantile(1e-20), -9.262340089798405, 1e-13);
+  EXPECT_NEAR(standard.Quantile(0.02), -2.0537489106318225, 1e-14);
+  EXPECT_NEAR(standard.Quantile(0.7), 0.5244005127080407, 1e-15);
+  EXPECT_NEAR(standard.Quantile(0.975), 1.9599639845400536, 1e-14);
+  EXPECT_TRUE(std::isinf(standard.Quantile(1.0)));
+  EXPECT_THROW(static_cast<void>(standard.Quantile(1.5)), std::invalid_argument);
+
+  std::vector<std::shared_ptr<Distribution>> continuous = {
+      std::make_shared<NormalDistribution>(1.0, 3.0),
+      std::make_shared<UniformDistribution>(-2.0, 5.0),
+      std::make_shared<ExponentialDistribution>(1.5),
+      std::make_shared<CauchyDistribution>(0.5, 2.0),
+      std::make_shared<LaplaceDistribution>(-1.0, 0.5),
+  };
+
+  for (const auto& dist : continuous) {
+    for (double p : {1e-9, 0.01, 0.25, 0.5, 0.8, 0.999}) {
+      EXPECT_NEAR(dist->Cdf(dist->Quantile(p)), p, 1e-12 + 1e-10 * p);
+    }
+
+    // Бисекция по Cdf по умолчанию; в далёких хвостах Cdf сама теряет относительную точность
+    for (double p : {0.01, 0.25, 0.5, 0.8}) {
+      EXPECT_NEAR(dist->Distribution::Quantile(p), dist->Quantile(p), 1e-9 * (1 + std::abs(dist->Quantile(p))));
+    }
+  }
+
+  std::vector<std::shared_ptr<Distribution>> discrete = {
+      std::make_shared<BernoulliDistribution>(0.3),
+      std::make_shared<BinomialDistribution>(500, 0.2),
+      std::make_shared<GeometricDistribution>(0.1),
+      std::make_shared<PoissonDistribution>(40.0),
+  };
+
+  for (const auto& dist : discrete) {
+    for (double p : {0.001, 0.1, 0.5, 0.7, 0.99}) {
+      double k = dist->Quantile(p);
+      EXPECT_GE(dist->Cdf(k), p);
+      EXPECT_LT(dist->Cdf(k - 1), p);
+    }
+  }
+
+  BinomialDistribution table(500, 0.2);
+  table.EnableTable();
+  EXPECT_EQ(table.Quantile(0.37), discrete[1]->Quantile(0.37));
+}
+
+TEST(DistributionTest, QuantileTableApproximatesQuantile) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<NormalDistribution>(2.0, 0.5);
+  QuantileTable table(dist);
+
+  for (double p = 0.0001; p < 1; p += 0.0137) {
+    EXPECT_NEAR(table.Evaluate(p), dist->Quantile(p), 1e-5);
+  }
+
+  EXPECT_NEAR(table.Evaluate(1e-12), dist->Quantile(1e-12), 1e-12);
+
+  Philox4x32 rng(17);
+  std::vector<double> values(100000);
+  table.Fill(rng, values);
+
+  double mean = std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+  EXPECT_NEAR(mean, 2.0, 0.01);
+}
+
+TEST(DistributionExperimentTest, RandomizedQmcBeatsMonteCarlo) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<NormalDistribution>(3.0, 2.0);
+  DistributionExperiment experiment(dist, 4096);
+
+  Philox4x32 rng(11);
+  RqmcStats rqmc = experiment.RunRandomizedQmc(rng, 16);
+
+  // У обычного Монте-Карло стандартная ошибка среднего 2 / sqrt(4096 * 16) ~ 0.008
+  EXPECT_EQ(rqmc.replications, 16u);
+  EXPECT_LT(rqmc.mean_standard_error, 1e-3);
+  EXPECT_LT(std::abs(rqmc.stats.mean_error), 6 * rqmc.mean_standard_error + 1e-12);
+  EXPECT_NEAR(rqmc.stats.empirical_variance, 4.0, 0.01);
+
+  ExperimentStats qmc = experiment.RunQmc(rng);
+  EXPECT_NEAR(qmc.empirical_mean, 3.0, 1e-2);
+
+  DistributionExperiment too_long(dist, kSobolSequencePeriod + 1);
+  EXPECT_THROW(static_cast<void>(too_long.RunQmc(rng)), std::invalid_argument);
+}
+
+TEST(DistributionTest, MomentAccumulatorMatchesTwoPass) {
+  using namespace ptm;
+
+  std::mt19937 rng(3);
+  std::vector<double> values(10001);
+  ExponentialDistribution(2.0).SampleBatch(rng, values);
+
+  double mean = std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+  double m2 = 0;
+  double m3 = 0;
+  double m4 = 0;
+
+  for (double value : values) {
+    m2 += std::pow(value - mean, 2);
+    m3 += std::pow(value - mean, 3);
+    m4 += std::pow(value - mean, 4);
+  }
+
+  const auto n = static_cast<double>(values.size());
+
+  MomentAccumulator batched;
+  MomentAccumulator merged;
+  MomentAccumulator single;
+  batched.AddBatch(std::span<const double>(values).first(5000));
+  batched.AddBatch(std::span<const double>(values).subspan(5000));
+
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    single.Add(values[i]);
+  }
+
+  MomentAccumulator left;
+  MomentAccumulator right;
+  left.AddBatch(std::span<const double>(values).first(777));
+  right.AddBatch(std::span<const double>(values).subspan(777));
+  merged.Merge(left);
+  merged.Merge(right);
+
+  for (const MomentAccumulator& moments : {batched, merged, single}) {
+    EXPECT_EQ(moments.Count(), values.size());
+    EXPECT_NEAR(moments.Mean(), mean, 1e-12);
+    EXPECT_NEAR(moments.Variance(), m2 / n, 1e-12);
+    EXPECT_NEAR(moments.Skewness(), std::sqrt(n) * m3 / std::pow(m2, 1.5), 1e-10);
+    EXPECT_NEAR(moments.Kurtosis(), n * m4 / (m2 * m2) - 3, 1e-9);
+    EXPECT_EQ(moments.Min(), *std::min_element(values.begin(), values.end()));
+    EXPECT_EQ(moments.Max(), *std::max_element(values.begin(), values.end()));
+  }
+}
+
+TEST(DistributionExperimentTest, RunReportsShapeAndRange) {
+  using namespace ptm;
+
+  Philox4x32 rng(21);
+  DistributionExperiment experiment(std::make_shared<ExponentialDistribution>(1.0), 1000000);
+
+  ExperimentStats stats = experiment.Run(rng);
+
+  EXPECT_NEAR(stats.skewness, 2.0, 0.1);
+  EXPECT_NEAR(stats.kurtosis, 6.0, 0.6);
+  EXPECT_GE(stats.min, 0.0);
+  EXPECT_GT(stats.max, 10.0);
+}
+
+TEST(DistributionExperimentTest, RunParallelIndependentOfThreadCount) {
+  using namespace ptm;
+
+  DistributionExperiment experiment(std::make_shared<PoissonDistribution>(6.0), 1000003);
+
+  ExperimentStats single = experiment.RunParallel(77, 1);
+  ExperimentStats several = experiment.RunParallel(77, 3);
+  ExperimentStats many = experiment.RunParallel(77, 16);
+
+  EXPECT_EQ(single.empirical_mean, several.empirical_mean);
+  EXPECT_EQ(single.empirical_variance, several.empirical_variance);
+  EXPECT_EQ(single.kurtosis, several.kurtosis);
+  EXPECT_EQ(single.empirical_mean, many.empirical_mean);
+  EXPECT_EQ(single.max, many.max);
+
+  EXPECT_NEAR(single.empirical_mean, 6.0, 0.01);
+  EXPECT_NEAR(single.empirical_variance, 6.0, 0.05);
+  EXPECT_NE(experiment.RunParallel(78, 2).empirical_mean, single.empirical_mean);
+}
+
+TEST(DistributionExperimentTest, EmpiricalCdfUsesCallSampleSize) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<PoissonDistribution>(3.0);
+  DistributionExperiment experiment(dist, 10);
+
+  std::vector<double> grid = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+  std::vector<double> irregular = {-1, 0, 0.5, 2, 2.5, 7, 40};
+
+  std::mt19937 rng(4);
+  auto ecdf = experiment.EmpiricalCdf(grid, rng, 300000);
+  EXPECT_LT(experiment.KolmogorovDistance(grid, ecdf), 0.005);
+
+  auto irregular_ecdf = experiment.EmpiricalCdf(irregular, rng, 300000);
+  EXPECT_EQ(irregular_ecdf.front(), 0.0);
+  EXPECT_EQ(irregular_ecdf.back(), 1.0);
+  EXPECT_LT(experiment.KolmogorovDistance(irregular, irregular_ecdf), 0.005);
+
+  auto single = experiment.EmpiricalCdfParallel(grid, 5, 300000, 1);
+  auto several = experiment.EmpiricalCdfParallel(grid, 5, 300000, 4);
+  EXPECT_EQ(single, several);
+  EXPECT_LT(experiment.KolmogorovDistance(grid, several), 0.005);
+
+  std::vector<double> unsorted = {1, 0};
+  EXPECT_THROW(experiment.EmpiricalCdf(unsorted, rng, 10), std::invalid_argument);
+}
+
+TEST(DistributionTest, GridBinningMatchesLowerBound) {
+  using namespace ptm;
+
+  std::vector<double> uniform_grid;
+
+  for (int j = 0; j <= 100; ++j) {
+    uniform_grid.push_back(-1 + 0.02 * j);
+  }
+
+  std::vector<double> irregular_grid = {-3, -1, -0.5, 0, 0, 0.1, 2, 8};
+
+  EXPECT_TRUE(GridBinning(uniform_grid).IsUniform());
+  EXPECT_FALSE(GridBinning(irregular_grid).IsUniform());
+
+  for (const auto& grid : {uniform_grid, irregular_grid}) {
+    GridBinning binning(grid);
+
+    std::vector<double> probes = {-10, 10, 0, 0.1, 0.02, -1, 1};
+    probes.insert(probes.end(), grid.begin(), grid.end());
+
+    for (double probe : probes) {
+      auto expected = std::lower_bound(grid.begin(), grid.end(), probe) - grid.begin();
+      EXPECT_EQ(binning.Bin(probe), static_cast<std::size_t>(expected)) << probe;
+    }
+  }
+}
+
+TEST(DistributionTest, KolmogorovDistributionValues) {
+  using namespace ptm;
+
+  // Пример из статьи Marsaglia, Tsang, Wang (2003)
+  EXPECT_NEAR(KolmogorovExactCdf(10, 0.274), 0.6284796154565043, 1e-13);
+  EXPECT_NEAR(KolmogorovAsymptoticPValue(1.3581), 0.05, 1e-4);
+  EXPECT_NEAR(KolmogorovAsymptoticPValue(1.6276), 0.01, 1e-4);
+  EXPECT_NEAR(KolmogorovAsymptoticPValue(0.5), 1 - 0.036055, 1e-5);
+  EXPECT_NEAR(1 - KolmogorovExactCdf(1000, 0.05), KolmogorovAsymptoticPValue(std::sqrt(1000.0) * 0.05), 2e-3);
+  EXPECT_THROW((void)KolmogorovExactCdf(0, 0.5), std::invalid_argument);
+}
+
+TEST(DistributionExperimentTest, GoodnessOfFitAcceptsTrueAndRejectsWrongModel) {
+  using namespace ptm;
+
+  Philox4x32 rng(31);
+  DistributionExperiment experiment(std::make_shared<NormalDistribution>(0.0, 1.0), 1000);
+
+  GoodnessOfFitResult fit = experiment.TestGoodnessOfFit(rng, 500, 2);
+  EXPECT_EQ(fit.sample_size, 500u);
+  EXPECT_GT(fit.ks_p_value_exact, 0.001);
+  EXPECT_NEAR(fit.ks_p_value_exact, fit.ks_p_value_asymptotic, 0.05);
+  EXPECT_LT(fit.anderson_darling, 6.0);
+  EXPECT_LT(fit.cramer_von_mises, 1.2);
+
+  std::vector<double> sample(200000);
+  NormalDistribution(0.0, 1.0).SampleBatch(rng, sample);
+  GoodnessOfFitResult large = GoodnessOfFit(NormalDistribution(0.0, 1.0), sample, 4);
+  EXPECT_TRUE(std::is_sorted(sample.begin(), sample.end()));
+  EXPECT_TRUE(std::isnan(large.ks_p_value_exact));
+  EXPECT_GT(large.ks_p_value_asymptotic, 0.001);
+
+  GoodnessOfFitResult wrong = GoodnessOfFit(LaplaceDistribution(0.0, 1.0), sample, 4);
+  EXPECT_LT(wrong.ks_p_value_asymptotic, 1e-6);
+  EXPECT_GT(wrong.anderson_darling, 10.0);
+  EXPECT_GT(wrong.cramer_von_mises, 1.0);
+}
+
+TEST(DistributionTest, KllSketchBoundsRankError) {
+  using namespace ptm;
+
+  std::mt19937 rng(8);
+  std::uniform_real_distribution<double> uniform(0, 1);
+  std::vector<double> values(200000);
+
+  for (double& value : values) {
+    value = uniform(rng);
+  }
+
+  KllSketch left;
+  KllSketch right(kKllDefaultK, 1);
+  left.UpdateBatch(std::span<const double>(values).first(values.size() / 2));
+  right.UpdateBatch(std::span<const double>(values).subspan(values.size() / 2));
+  left.Merge(right);
+
+  EXPECT_EQ(left.Count(), values.size());
+  EXPECT_LT(left.RetainedItems(), 2000);
+
+  std::sort(values.begin(), values.end());
+  const double tolerance = left.NormalizedRankError();
+
+  for (double x : {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99}) {
+    const double rank = static_cast<double>(std::upper_bound(values.begin(), values.end(), x) - values.begin()) /
+                        static_cast<double>(values.size());
+    EXPECT_NEAR(left.Rank(x), rank, tolerance);
+    EXPECT_NEAR(left.Quantile(x), x, tolerance);
+  }
+
+  EXPECT_THROW(KllSketch(1), std::invalid_argument);
+}
+
+TEST(DistributionExperimentTest, SketchKolmogorovDistance) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<NormalDistribution>(0.0, 1.0);
+  DistributionExperiment experiment(dist, 10);
+
+  auto single = experiment.SketchParallel(9, 1000000, 1);
+  auto several = experiment.SketchParallel(9, 1000000, 4);
+  EXPECT_EQ(single.Count(), 1000000);
+  EXPECT_EQ(single.Cdf(std::vector<double>{-1, 0, 1}), several.Cdf(std::vector<double>{-1, 0, 1}));
+  EXPECT_LT(experiment.KolmogorovDistance(several), several.NormalizedRankError());
+
+  // Эскиз хранит O(k log(n / k)) значений: рост выборки в 16 раз почти не меняет его размер
+  auto small = experiment.SketchParallel(9, 125000, 2);
+  auto large = experiment.SketchParallel(9, 2000000, 2);
+  EXPECT_EQ(large.Count(), 2000000);
+  EXPECT_LT(large.RetainedItems(), 4 * kKllDefaultK);
+  EXPECT_LT(large.RetainedItems(), small.RetainedItems() + kKllDefaultK);
+
+  std::mt19937 rng(10);
+  auto sketch = experiment.Sketch(rng, 100000);
+  EXPECT_NEAR(sketch.Cdf(std::vector<double>{0})[0], 0.5, sketch.NormalizedRankError());
+
+  auto shifted = std::make_shared<NormalDistribution>(0.5, 1.0);
+  EXPECT_GT(DistributionExperiment(shifted, 10).KolmogorovDistance(sketch), 0.15);
+}
+
+TEST(DistributionExperimentTest, ReplicatedExperimentCoversTrueMean) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<ExponentialDistribution>(2.0);
+  ReplicatedExperiment experiment(dist, 100, 20000);
+
+  auto single = experiment.Run(12, 1);
+  auto several = experiment.Run(12, 4);
+  EXPECT_EQ(single.replicas.empirical_mean, several.replicas.empirical_mean);
+  EXPECT_EQ(single.replicas.empirical_mean.size(), 20000);
+
+  // Среднее по репликам несмещено, его CI накрывает 0; разброс mean_error - sigma / sqrt(n)
+  EXPECT_LT(several.mean_error.ci_lower, 0.0);
+  EXPECT_GT(several.mean_error.ci_upper, 0.0);
+  EXPECT_NEAR(several.mean_error.standard_deviation, 0.5 / std::sqrt(100.0), 0.002);
+  EXPECT_NEAR(several.mean_error.quantile_upper - several.mean_error.quantile_lower,
+              2 * 1.96 * 0.05,
+              0.01);
+
+  // Смещённая (делённая на n) дисперсия занижена в (n - 1) / n раз
+  EXPECT_NEAR(several.empirical_variance.mean, 0.25 * 99 / 100, 3 * several.empirical_variance.standard_error);
+
+  EXPECT_THROW(ReplicatedExperiment(dist, 100, 1), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(experiment.Run(12, 1, 1.5)), std::invalid_argument);
+}
+
+TEST(DistributionExperimentTest, AntitheticAndControlVariateReduceVariance) {
+  using namespace ptm;
+
+  auto exponential = std::make_shared<ExponentialDistribution>(2.0);
+  DistributionExperiment experiment(exponential, 200000);
+  std::mt19937 rng(14);
+
+  // Corr(Q(u), Q(1 - u)) = 1 - pi^2 / 6 для экспоненциального: выигрыш 1 / (2 - pi^2 / 6) ~ 2.8
+  auto antithetic = experiment.RunAntithetic(rng);
+  EXPECT_NEAR(antithetic.variance_reduction, 1 / (2 - std::numbers::pi * std::numbers::pi / 6), 0.2);
+  EXPECT_LT(std::abs(antithetic.stats.mean_error), 4 * antithetic.mean_standard_error);
+  EXPECT_NEAR(antithetic.stats.empirical_variance, 0.25, 0.01);
+
+  // Corr(X, U)^2 = 3/4: выигрыш 4
+  auto control = experiment.RunControlVariate(rng);
+  EXPECT_NEAR(control.variance_reduction, 4.0, 0.2);
+  EXPECT_LT(std::abs(control.stats.mean_error), 4 * control.mean_standard_error);
+
+  // Для симметричного распределения отражённая пара даёт центр точно
+  auto normal = std::make_shared<NormalDistribution>(1.0, 2.0);
+  auto reflected = DistributionExperiment(normal, 100000).RunAntithetic(rng);
+  EXPECT_NEAR(reflected.stats.mean_error, 0.0, 1e-12);
+  EXPECT_GT(reflected.variance_reduction, 1e6);
+  EXPECT_NEAR(reflected.stats.empirical_variance, 4.0, 0.1);
+
+  EXPECT_THROW(static_cast<void>(DistributionExperiment(normal, 3).RunAntithetic(rng)), std::invalid_argument);
+}
+
+TEST(DistributionTest, TailImportanceSamplerEstimatesRareTails) {
+  using namespace ptm;
+
+  std::mt19937 rng(16);
+
+  // P(N(0, 1) > 6) ~ 1e-9: обычному Монте-Карло нужно ~1e11 сэмплов для 10% точности
+  auto normal = std::make_shared<NormalDistribution>(0.0, 1.0);
+  auto normal_tail = TailImportanceSampler(normal, 6.0).Estimate(rng, 100000);
+  const double normal_exact = 1 - normal->Cdf(6.0);
+  EXPECT_NEAR(normal_tail.probability, normal_exact, 4 * normal_tail.standard_error);
+  EXPECT_LT(normal_tail.relative_error, 0.02);
+  EXPECT_GT(normal_tail.effective_sample_size, 1000);
+
+  auto exponential = std::make_shared<ExponentialDistribution>(1.0);
+  auto exponential_tail = TailImportanceSampler(exponential, 30.0).Estimate(rng, 100000);
+  EXPECT_NEAR(exponential_tail.probability / std::exp(-30.0), 1.0, 0.05);
+
+  auto laplace = std::make_shared<LaplaceDistribution>(1.0, 2.0);
+  auto laplace_tail = TailImportanceSampler(laplace, 41.0).Estimate(rng, 100000);
+  EXPECT_NEAR(laplace_tail.probability / (0.5 * std::exp(-20.0)), 1.0, 0.02);
+
+  auto poisson = std::make_shared<PoissonDistribution>(3.0);
+  EXPECT_THROW(TailImportanceSampler(poisson, 30.0), std::invalid_argument);
+  EXPECT_THROW(TailImportanceSampler(nullptr, 30.0), std::invalid_argument);
+}
+
+TEST(DistributionExperimentTest, SequentialStopsAtTargetPrecision) {
+  using namespace ptm;
+
+  auto normal = std::make_shared<NormalDistribution>(3.0, 1.0);
+  DistributionExperiment experiment(normal, 10);
+  std::mt19937 rng(18);
+
+  // Нужно около (1.96 / 0.01)^2 ~ 38400 сэмплов; партии 4096, 8192, ... дают 61440
+  SequentialOptions absolute;
+  absolute.absolute_precision = 0.01;
+  auto converged = experiment.RunSequential(rng, absolute);
+  EXPECT_EQ(converged.status, SequentialStatus::kConverged);
+  EXPECT_LE(converged.half_width, 0.01);
+  EXPECT_EQ(converged.samples_used, 61440);
+  EXPECT_EQ(converged.batches, 4);
+  EXPECT_LT(std::abs(converged.stats.mean_error), 0.015);
+
+  SequentialOptions relative;
+  relative.relative_precision = 1e-3;
+  EXPECT_LE(experiment.RunSequential(rng, relative).half_width, 3e-3);
+
+  SequentialOptions budget;
+  budget.absolute_precision = 1e-4;
+  budget.max_samples = 100000;
+  auto exhausted = experiment.RunSequential(rng, budget);
+  EXPECT_EQ(exhausted.status, SequentialStatus::kBudgetExhausted);
+  EXPECT_EQ(exhausted.samples_used, 100000);
+
+  auto cauchy = std::make_shared<CauchyDistribution>(0.0, 1.0);
+  auto diverged = DistributionExperiment(cauchy, 10).RunSequential(rng, absolute);
+  EXPECT_EQ(diverged.status, SequentialStatus::kNonConvergent);
+  EXPECT_EQ(diverged.samples_used, kSampleBatchSize);
+
+  EXPECT_THROW(static_cast<void>(experiment.RunSequential(rng, SequentialOptions{})), std::invalid_argument);
+
+  // Огромный множитель: вторая партия упирается в бюджет, а не в переполнение size_t
+  SequentialOptions huge_growth = budget;
+  huge_growth.growth_factor = 1e300;
+  EXPECT_EQ(experiment.RunSequential(rng, huge_growth).samples_used, 100000);
+
+  for (double growth_factor : {std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity()}) {
+    SequentialOptions invalid = budget;
+    invalid.growth_factor = growth_factor;
+    EXPECT_THROW(static_cast<void>(experiment.RunSequential(rng, invalid)), std::invalid_argument);
+  }
+}
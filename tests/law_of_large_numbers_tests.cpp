@@ -3,13 +3,20 @@
 
 #include "lib/distributions/BernoulliDistribution.hpp"
 #include "lib/distributions/BinomialDistribution.hpp"
+#include "lib/distributions/CauchyDistribution.hpp"
 #include "lib/distributions/ExponentialDistribution.hpp"
 #include "lib/distributions/GeometricDistribution.hpp"
 #include "lib/distributions/LaplaceDistribution.hpp"
 #include "lib/distributions/NormalDistribution.hpp"
 #include "lib/distributions/PoissonDistribution.hpp"
 #include "lib/distributions/UniformDistribution.hpp"
+#include "lib/law-of-large-numbers/CheckpointSchedule.hpp"
+#include "lib/law-of-large-numbers/CompensatedSum.hpp"
+#include "lib/law-of-large-numbers/LLNEnsemble.hpp"
+#include "lib/law-of-large-numbers/P2Quantile.hpp"
+#include "lib/law-of-large-numbers/StreamingTrimmedMean.hpp"
 #include "lib/law-of-large-numbers/LawOfLargeNumbersSimulator.hpp"
+#include "lib/law-of-large-numbers/LawOfLargeNumbersSimulatorT.hpp"
 
 TEST(LawOfLargeNumbersTest, BernoulliMeanConverges) {
   using namespace ptm;
@@ -252,3 +259,259 @@ TEST(LawOfLargeNumbersTest, UniformMeanConverges) {
     EXPECT_EQ(result.entries[i].n, result.entries[i - 1].n + step);
   }
 }
+
+TEST(LawOfLargeNumbersTest, StaticDispatchMatchesPolymorphic) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<PoissonDistribution>(4.0);
+
+  std::mt19937 rng_static(9);
+  std::mt19937 rng_polymorphic(9);
+
+  LLNPathResult typed = LawOfLargeNumbersSimulatorT<PoissonDistribution>(dist).Simulate(rng_static, 20000, 1000);
+  LLNPathResult result = LawOfLargeNumbersSimulator(dist).Simulate(rng_polymorphic, 20000, 1000);
+
+  ASSERT_EQ(typed.entries.size(), result.entries.size());
+  EXPECT_EQ(typed.entries.back().sample_mean, result.entries.back().sample_mean);
+}
+
+TEST(LawOfLargeNumbersTest, CompensatedSumKeepsSmallTerms) {
+  using namespace ptm;
+
+  // Шаг double около 1e16 равен 2: простая сумма теряет каждое прибавленное 1
+  CompensatedSum sum;
+  double naive = 1e16;
+  sum.Add(1e16);
+
+  for (int i = 0; i < 10000; ++i) {
+    sum.Add(1.0);
+    naive += 1.0;
+  }
+
+  EXPECT_EQ(sum.Value(), 1e16 + 10000);
+  EXPECT_EQ(naive, 1e16);
+
+  std::vector<double> ones(10000, 1.0);
+  CompensatedSum batched;
+  batched.Add(1e16);
+  batched.AddBatch(ones);
+  EXPECT_EQ(batched.Value(), 1e16 + 10000);
+}
+
+TEST(LawOfLargeNumbersTest, SinkReceivesEntriesAsProduced) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<ExponentialDistribution>(0.5);
+  LawOfLargeNumbersSimulator sim(dist);
+
+  std::mt19937 rng_collected(11);
+  std::mt19937 rng_streamed(11);
+
+  LLNPathResult collected = sim.Simulate(rng_collected, 50000, 700);
+  std::vector<LLNPathEntry> streamed;
+  sim.Simulate(rng_streamed, 50000, 700, [&streamed](const LLNPathEntry& entry) { streamed.push_back(entry); });
+
+  ASSERT_EQ(streamed.size(), 50000 / 700);
+  ASSERT_EQ(collected.entries.size(), streamed.size());
+
+  for (std::size_t i = 0; i < streamed.size(); ++i) {
+    EXPECT_EQ(streamed[i].n, (i + 1) * 700);
+    EXPECT_EQ(streamed[i].sample_mean, collected.entries[i].sample_mean);
+  }
+
+  EXPECT_THROW(sim.Simulate(rng_streamed, 10, 0, [](const LLNPathEntry&) {}), std::invalid_argument);
+}
+
+TEST(LawOfLargeNumbersTest, JumpAheadMatchesSumDistribution) {
+  using namespace ptm;
+
+  LLNOptions options;
+  options.jump_ahead = true;
+
+  // Выборочное среднее step сэмплов: матожидание mu, дисперсия sigma^2 / step
+  const std::vector<std::shared_ptr<Distribution>> distributions = {
+      std::make_shared<BernoulliDistribution>(0.3),
+      std::make_shared<BinomialDistribution>(7, 0.4),
+      std::make_shared<PoissonDistribution>(2.5),
+      std::make_shared<ExponentialDistribution>(1.5),
+      std::make_shared<GeometricDistribution>(0.2),
+      std::make_shared<NormalDistribution>(-1.0, 3.0),
+  };
+
+  const std::size_t step = 1000;
+  const int paths = 4000;
+  std::mt19937 rng(21);
+
+  for (const auto& dist : distributions) {
+    LawOfLargeNumbersSimulator sim(dist);
+    ASSERT_TRUE(sim.SupportsJumpAhead());
+
+    double sum = 0;
+    double squares = 0;
+
+    for (int path = 0; path < paths; ++path) {
+      const double mean = sim.Simulate(rng, step, step, options).entries.front().sample_mean;
+      sum += mean;
+      squares += mean * mean;
+    }
+
+    const double mean = sum / paths;
+    const double variance = squares / paths - mean * mean;
+    const double expected_variance = dist->TheoreticalVariance() / step;
+    EXPECT_NEAR(mean, dist->TheoreticalMean(), 5 * std::sqrt(expected_variance / paths));
+    EXPECT_NEAR(variance / expected_variance, 1.0, 0.1);
+  }
+
+  // 10^12 шагов за 10^3 розыгрышей
+  auto normal = std::make_shared<NormalDistribution>(2.0, 1.0);
+  LLNPathResult far = LawOfLargeNumbersSimulator(normal).Simulate(rng, 1000000000000, 1000000000, options);
+  ASSERT_EQ(far.entries.size(), 1000);
+  EXPECT_EQ(far.entries.back().n, 1000000000000);
+  EXPECT_LT(far.entries.back().abs_error, 5e-6);
+
+  // Сумма Коши - снова Коши с масштабом step * gamma: среднее не сходится
+  auto cauchy = std::make_shared<CauchyDistribution>(0.0, 1.0);
+  EXPECT_TRUE(LawOfLargeNumbersSimulator(cauchy).SupportsJumpAhead());
+  EXPECT_FALSE(LawOfLargeNumbersSimulator(std::make_shared<UniformDistribution>(0.0, 1.0)).SupportsJumpAhead());
+}
+
+TEST(LawOfLargeNumbersTest, EnsembleQuantileBands) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<NormalDistribution>(1.0, 2.0);
+  LLNEnsemble ensemble(dist, 1000);
+
+  LLNEnsembleResult single = ensemble.Run(23, 5000, 100, 1);
+  LLNEnsembleResult several = ensemble.Run(23, 5000, 100, 4);
+
+  ASSERT_EQ(several.n.size(), 50);
+  ASSERT_EQ(several.abs_error_quantiles.size(), kLLNEnsembleQuantileLevels.size());
+  EXPECT_EQ(single.abs_error_quantiles, several.abs_error_quantiles);
+
+  // |mean_n - mu| ~ |N(0, sigma^2 / n)|: квантили 5/50/95% - 0.0627, 0.674 и 1.96 sigma / sqrt(n)
+  const double scale = 2.0 / std::sqrt(5000.0);
+  EXPECT_NEAR(several.abs_error_quantiles[0].back() / scale, 0.0627, 0.015);
+  EXPECT_NEAR(several.abs_error_quantiles[1].back() / scale, 0.674, 0.08);
+  EXPECT_NEAR(several.abs_error_quantiles[2].back() / scale, 1.96, 0.2);
+  EXPECT_NEAR(several.convergence_exponent, -0.5, 0.05);
+
+  for (std::size_t k = 0; k < several.n.size(); ++k) {
+    EXPECT_LE(several.abs_error_quantiles[0][k], several.abs_error_quantiles[1][k]);
+    EXPECT_LE(several.abs_error_quantiles[1][k], several.abs_error_quantiles[2][k]);
+  }
+
+  auto cauchy = std::make_shared<CauchyDistribution>(0.0, 1.0);
+  EXPECT_THROW(static_cast<void>(LLNEnsemble(cauchy, 10).Run(1, 100, 10)), std::invalid_argument);
+}
+
+TEST(LawOfLargeNumbersTest, CheckpointSchedules) {
+  using namespace ptm;
+
+  EXPECT_EQ(CheckpointSchedule::Linear(250).Points(1000), (std::vector<std::size_t>{250, 500, 750, 1000}));
+
+  auto log_spaced = CheckpointSchedule::LogSpaced(100, 10).Points(10000000000);
+  ASSERT_EQ(log_spaced.size(), 81);
+  EXPECT_EQ(log_spaced.front(), 100);
+  EXPECT_EQ(log_spaced[10], 1000);
+  EXPECT_EQ(log_spaced.back(), 10000000000);
+
+  // При малом ratio округление склеивает точки, но сетка строго возрастает
+  auto dense = CheckpointSchedule::Geometric(1, 1.1).Points(1000);
+  EXPECT_EQ(dense.front(), 1);
+  EXPECT_TRUE(std::adjacent_find(dense.begin(), dense.end(), std::greater_equal<>()) == dense.end());
+
+  auto hybrid = CheckpointSchedule::Hybrid(1000, 10.0, {1, 2, 5, 10, 5000}).Points(100000);
+  EXPECT_EQ(hybrid, (std::vector<std::size_t>{1, 2, 5, 10, 1000, 5000, 10000, 100000}));
+
+  EXPECT_EQ(CheckpointSchedule::Explicit({3, 30}).Next(30), std::numeric_limits<std::size_t>::max());
+  EXPECT_THROW(CheckpointSchedule::Explicit({3, 3}), std::invalid_argument);
+  EXPECT_THROW(CheckpointSchedule::Geometric(1, 1.0), std::invalid_argument);
+
+  auto dist = std::make_shared<ExponentialDistribution>(0.5);
+  LawOfLargeNumbersSimulator sim(dist);
+  const auto schedule = CheckpointSchedule::LogSpaced(10, 4);
+  std::mt19937 rng(25);
+
+  LLNPathResult direct = sim.Simulate(rng, 100000, schedule);
+  ASSERT_EQ(direct.entries.size(), schedule.Points(100000).size());
+
+  for (std::size_t k = 0; k < direct.entries.size(); ++k) {
+    EXPECT_EQ(direct.entries[k].n, schedule.Points(100000)[k]);
+  }
+
+  EXPECT_LT(direct.entries.back().abs_error, 0.03);
+
+  LLNOptions options;
+  options.jump_ahead = true;
+  LLNPathResult jumped = sim.Simulate(rng, 1000000000000, schedule, options);
+  ASSERT_EQ(jumped.entries.size(), 45);
+  EXPECT_LT(jumped.entries.back().abs_error, 2e-5);
+
+  LLNEnsembleResult bands = LLNEnsemble(dist, 200).Run(26, 10000, schedule);
+  EXPECT_EQ(bands.n, schedule.Points(10000));
+  EXPECT_NEAR(bands.convergence_exponent, -0.5, 0.1);
+}
+
+TEST(LawOfLargeNumbersTest, P2QuantileTracksQuantiles) {
+  using namespace ptm;
+
+  std::mt19937 rng(27);
+  std::exponential_distribution<double> exponential(1.0);
+  P2Quantile median(0.5);
+  P2Quantile upper(0.9);
+  StreamingTrimmedMean trimmed(0.1);
+
+  EXPECT_TRUE(std::isnan(median.Value()));
+
+  for (int i = 0; i < 200000; ++i) {
+    const double value = exponential(rng);
+    median.Add(value);
+    upper.Add(value);
+    trimmed.Add(value);
+  }
+
+  EXPECT_NEAR(median.Value(), std::log(2.0), 0.01);
+  EXPECT_NEAR(upper.Value(), std::log(10.0), 0.02);
+
+  // Среднее Exp(1) между квантилями 0.1 и 0.9: (int_{a}^{b} x e^{-x} dx) / 0.8
+  const double a = -std::log(0.9);
+  const double b = std::log(10.0);
+  const double expected = ((a + 1) * std::exp(-a) - (b + 1) * std::exp(-b)) / 0.8;
+  EXPECT_NEAR(trimmed.Value(), expected, 0.01);
+
+  EXPECT_THROW(P2Quantile(1.0), std::invalid_argument);
+  EXPECT_THROW(StreamingTrimmedMean(0.5), std::invalid_argument);
+}
+
+TEST(LawOfLargeNumbersTest, RobustEstimatorsConvergeForCauchy) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<CauchyDistribution>(3.0, 1.0);
+  LawOfLargeNumbersSimulator sim(dist);
+
+  LLNOptions options;
+  options.track_median = true;
+  options.trim_fraction = 0.25;
+
+  std::mt19937 rng(29);
+  LLNPathResult result = sim.Simulate(rng, 200000, CheckpointSchedule::LogSpaced(100, 2), options);
+  const LLNPathEntry& last = result.entries.back();
+
+  EXPECT_EQ(last.n, 100000);
+  EXPECT_TRUE(std::isnan(last.abs_error));
+  ASSERT_TRUE(last.running_median.has_value());
+  ASSERT_TRUE(last.trimmed_mean.has_value());
+  EXPECT_NEAR(*last.running_median, 3.0, 0.02);
+  EXPECT_NEAR(*last.trimmed_mean, 3.0, 0.02);
+
+  LLNPathResult plain = sim.Simulate(rng, 1000, 100);
+  EXPECT_FALSE(plain.entries.back().running_median.has_value());
+
+  options.jump_ahead = true;
+  EXPECT_THROW(static_cast<void>(sim.Simulate(rng, 1000, 100, options)), std::invalid_argument);
+
+  // У Laplace нет SampleSum: jump_ahead игнорируется, робастные оценки остаются доступны
+  LawOfLargeNumbersSimulator laplace(std::make_shared<LaplaceDistribution>(3.0, 1.0));
+  LLNPathResult laplace_path = laplace.Simulate(rng, 1000, 100, options);
+  EXPECT_TRUE(laplace_path.entries.back().running_median.has_value());
+}
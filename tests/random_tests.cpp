@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "lib/distributions/DistributionExperiment.hpp"
+#include "lib/distributions/NormalDistribution.hpp"
+#include "lib/random/Philox4x32.hpp"
+#include "lib/random/SobolSequence.hpp"
+
+static_assert(std::uniform_random_bit_generator<ptm::Philox4x32>);
+
+TEST(Philox4x32Test, KnownAnswerVectors) {
+  using namespace ptm;
+
+  // Контрольные значения Random123 для philox4x32-10
+  auto zero = Philox4x32::Block({0, 0, 0, 0}, {0, 0});
+  EXPECT_EQ(zero[0], 0x6627e8d5u);
+  EXPECT_EQ(zero[1], 0xe169c58du);
+  EXPECT_EQ(zero[2], 0xbc57ac4cu);
+  EXPECT_EQ(zero[3], 0x9b00dbd8u);
+
+  auto pi = Philox4x32::Block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0});
+  EXPECT_EQ(pi[0], 0xd16cfe09u);
+  EXPECT_EQ(pi[1], 0x94fdccebu);
+  EXPECT_EQ(pi[2], 0x5001e420u);
+  EXPECT_EQ(pi[3], 0x24126ea1u);
+}
+
+TEST(Philox4x32Test, DiscardMatchesSequentialDraws) {
+  using namespace ptm;
+
+  Philox4x32 sequential(42, 7);
+  Philox4x32 skipped(42, 7);
+
+  for (int i = 0; i < 1001; ++i) {
+    sequential();
+  }
+  skipped.discard(1001);
+
+  EXPECT_EQ(sequential, skipped);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_EQ(sequential(), skipped());
+  }
+}
+
+TEST(Philox4x32Test, StreamsAreDistinct) {
+  using namespace ptm;
+
+  Philox4x32 first(42, 0);
+  Philox4x32 second(42, 1);
+
+  int equal = 0;
+  for (int i = 0; i < 1000; ++i) {
+    equal += first() == second() ? 1 : 0;
+  }
+
+  EXPECT_LT(equal, 3);
+}
+
+TEST(Philox4x32Test, DrivesDistributionExperiment) {
+  using namespace ptm;
+
+  Philox4x32 rng(123, 5);
+  auto dist = std::make_shared<NormalDistribution>(5.0, 2.0);
+  DistributionExperiment experiment(dist, 20000);
+
+  auto stats = experiment.Run(rng);
+
+  EXPECT_NEAR(stats.empirical_mean, dist->TheoreticalMean(), 0.1);
+  EXPECT_NEAR(stats.empirical_variance, dist->TheoreticalVariance(), 0.3);
+}
+
+TEST(SobolSequenceTest, PrefixesAreStratified) {
+  using namespace ptm;
+
+  for (std::uint32_t seed : {0u, 1u, 0xdeadbeefu}) {
+    SobolSequence sequence(seed);
+    std::vector<double> points(1024);
+    sequence.Fill(0, points);
+
+    for (std::size_t size : {2u, 16u, 256u, 1024u}) {
+      std::vector<int> cells(size, 0);
+
+      for (std::size_t i = 0; i < size; ++i) {
+        ASSERT_GT(points[i], 0.0);
+        ASSERT_LT(points[i], 1.0);
+        ++cells[static_cast<std::size_t>(points[i] * static_cast<double>(size))];
+      }
+
+      EXPECT_EQ(std::count(cells.begin(), cells.end(), 1), static_cast<std::ptrdiff_t>(size));
+    }
+  }
+
+  EXPECT_NE(SobolSequence(1)[0], SobolSequence(2)[0]);
+}